@@ -0,0 +1,516 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef ALLPAIRS_H
+#define ALLPAIRS_H
+
+#include "GraphAlgorithm.h"
+#include "GraphCSR.h"
+#include "Parallel.h"
+#include <vector>
+#include <thread>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace GraphAlgorithm {
+    // Define a namespace for All-Pairs Shortest Path algorithms.
+    namespace APSP {
+
+        // Distance table of every ordered vertex pair, stored as one row-major matrix.
+        // Rows are padded to a multiple of AllPairs::BlockSize cells; unreachable pairs hold the maximum WeightType.
+        // The optional predecessor matrix holds, for every reachable pair (u, v) with u != v, the vertex before v on a
+        // shortest path from u. Each row is a shortest-path tree of its source, so any path can be recovered backwards
+        // within one row in time proportional to its length.
+        template <typename WeightType>
+        class DistanceTable {
+        public:
+            // Constructor creates a table of the given size with every pair unreachable.
+            DistanceTable(int numVertices = 0, int stride = 0, bool withPredecessors = false)
+                : numVertices(numVertices), stride(stride),
+                  distances(static_cast<std::size_t>(stride) * stride, std::numeric_limits<WeightType>::max()),
+                  predecessors(withPredecessors ? static_cast<std::size_t>(stride) * stride : 0, -1) {}
+
+            // Returns the number of vertices the table covers.
+            int vertexCount() const {
+                return numVertices;
+            }
+
+            // Returns the shortest distance from one vertex to another, or the maximum WeightType if it is unreachable.
+            WeightType distance(int from, int to) const {
+                checkRange(from, to);
+                return distances[index(from, to)];
+            }
+
+            // Checks whether the table was computed with predecessors.
+            bool hasPredecessors() const {
+                return !predecessors.empty();
+            }
+
+            // Returns the vertex before to on a shortest path from from, or -1 when from == to or to is unreachable.
+            int predecessor(int from, int to) const {
+                checkRange(from, to);
+                if (!hasPredecessors()) {
+                    throw std::logic_error("Distance table was computed without predecessors");
+                }
+                return predecessors[index(from, to)];
+            }
+
+            // Reconstructs the shortest path between two vertices by walking back from to along the row of from.
+            // Throws std::logic_error if the walk does not reach from within vertexCount() steps.
+            SSSP::ShortestPath<WeightType> path(int from, int to) const {
+                SSSP::ShortestPath<WeightType> result;
+                if (distance(from, to) == std::numeric_limits<WeightType>::max()) {
+                    return result;
+                }
+                if (!hasPredecessors()) {
+                    throw std::logic_error("Distance table was computed without predecessors");
+                }
+                result.reachable = true;
+                result.totalWeight = distances[index(from, to)];
+                result.vertices.push_back(to);
+                for (int at = to; at != from;) {
+                    at = predecessors[index(from, at)];
+                    if (at == -1 || static_cast<int>(result.vertices.size()) == numVertices) {
+                        throw std::logic_error("Predecessors do not form a shortest-path tree");
+                    }
+                    result.vertices.push_back(at);
+                }
+                std::reverse(result.vertices.begin(), result.vertices.end());
+                return result;
+            }
+
+            // Returns a pointer to the first cell of a distance row; cells past vertexCount() are padding.
+            const WeightType* row(int from) const {
+                return distances.data() + static_cast<std::size_t>(from) * stride;
+            }
+
+        private:
+            template <typename, typename>
+            friend class AllPairs;
+
+            int numVertices;                   // Number of vertices covered.
+            int stride;                        // Cells per row, including padding.
+            std::vector<WeightType> distances; // Row-major distance matrix.
+            std::vector<int> predecessors;     // Row-major predecessor matrix, or empty.
+
+            std::size_t index(int from, int to) const {
+                return static_cast<std::size_t>(from) * stride + to;
+            }
+
+            void checkRange(int from, int to) const {
+                if (from < 0 || from >= numVertices || to < 0 || to >= numVertices) {
+                    throw std::out_of_range("Vertex index out of range");
+                }
+            }
+        };
+
+        // Class computing shortest distances between all pairs of vertices.
+        // FloydWarshall runs the cache-blocked Floyd-Warshall algorithm in O(V^3): for each diagonal tile, the tile itself is
+        // closed first, then the tiles sharing its row or column, then every other tile. The tiles of the last two phases are
+        // independent and are spread over threads. The min-plus inner loop updates a row segment of a tile at a time, with
+        // AVX2 vectors for float, double, int32 and int64 weights when the compiler targets them.
+        // Johnson runs Dijkstra from every source in parallel, which is O(V E log V) and much cheaper on sparse graphs.
+        // Negative edges are first removed by Bellman-Ford reweighting. Both methods accept negative edges and throw
+        // std::runtime_error on a negative cycle.
+        template <typename VertexType, typename WeightType>
+        class AllPairs {
+        public:
+            // Algorithm selection for execute.
+            enum class Method {
+                Automatic,     // FloydWarshall from FloydWarshallDensity edges per vertex pair, Johnson below it.
+                FloydWarshall, // Blocked Floyd-Warshall over the dense distance matrix.
+                Johnson        // Bellman-Ford reweighting (only if needed) and Dijkstra from every source.
+            };
+
+            // Side length of the square tiles of blocked Floyd-Warshall, in cells.
+            static constexpr int BlockSize = 64;
+            // Edge density (edges / vertices^2) from which Automatic picks Floyd-Warshall.
+            static constexpr double FloydWarshallDensity = 0.1;
+
+            // Computes the distance table of a graph, and its predecessors if requested.
+            // numThreads of zero uses one thread per hardware thread.
+            template <typename GraphType>
+            static DistanceTable<WeightType> execute(const GraphType& graph, Method method = Method::Automatic, bool withPredecessors = false,
+                                                     int numThreads = 0) {
+                numThreads = resolveThreadCount(numThreads);
+                int numVertices = graph.vertexCount();
+                if (method == Method::Automatic) {
+                    long long numEdges = 0;
+                    for (int u = 0; u < numVertices; ++u) {
+                        numEdges += static_cast<long long>(neighborsOf(graph, u).size());
+                    }
+                    method = numVertices > 0 && numEdges >= FloydWarshallDensity * numVertices * numVertices ? Method::FloydWarshall : Method::Johnson;
+                }
+                int stride = (numVertices + BlockSize - 1) / BlockSize * BlockSize;
+                DistanceTable<WeightType> table(numVertices, stride, withPredecessors);
+                if (method == Method::FloydWarshall) {
+                    floydWarshall(graph, table, numThreads);
+                } else {
+                    johnson(graph, table, numThreads);
+                }
+                return table;
+            }
+
+        private:
+            // Whether the predecessors of a vertex lead back to the source, while repairPredecessors classifies a row.
+            enum TreeState : char { Unknown, OnWalk, Attached, Detached };
+
+            // Blocked Floyd-Warshall over the table, which starts with the edge weights and zero diagonal.
+            template <typename GraphType>
+            static void floydWarshall(const GraphType& graph, DistanceTable<WeightType>& table, int numThreads) {
+                int numVertices = table.numVertices;
+                bool withPredecessors = table.hasPredecessors();
+                for (int u = 0; u < numVertices; ++u) {
+                    table.distances[table.index(u, u)] = 0;
+                }
+                for (int u = 0; u < numVertices; ++u) {
+                    for (const auto& edge : neighborsOf(graph, u)) {
+                        std::size_t cell = table.index(u, edge.first);
+                        if (edge.second < table.distances[cell]) {
+                            table.distances[cell] = edge.second; // Parallel edges keep the lightest.
+                            if (withPredecessors) {
+                                table.predecessors[cell] = u;
+                            }
+                        }
+                    }
+                }
+
+                int numBlocks = table.stride / BlockSize;
+                for (int kb = 0; kb < numBlocks; ++kb) {
+                    // Phase 1: the diagonal tile depends only on itself.
+                    closeTile(table, kb, kb, kb);
+                    // Phase 2: tiles in the diagonal tile's row and column.
+                    int sideTiles = 2 * (numBlocks - 1);
+                    int sideThreads = std::min(numThreads, std::max(1, sideTiles));
+                    runParallel(sideThreads, [&](int thread) {
+                        for (int t = thread; t < sideTiles; t += sideThreads) {
+                            int other = t / 2 < kb ? t / 2 : t / 2 + 1;
+                            if (t % 2 == 0) {
+                                closeTile(table, kb, other, kb);
+                            } else {
+                                closeTile(table, other, kb, kb);
+                            }
+                        }
+                    });
+                    // Phase 3: every remaining tile, from its row and column tiles of phase 2.
+                    int innerTiles = (numBlocks - 1) * (numBlocks - 1);
+                    int threads = std::min(numThreads, std::max(1, innerTiles));
+                    runParallel(threads, [&](int thread) {
+                        for (int t = thread; t < innerTiles; t += threads) {
+                            int ib = t / (numBlocks - 1);
+                            int jb = t % (numBlocks - 1);
+                            closeIndependentTile(table, ib < kb ? ib : ib + 1, jb < kb ? jb : jb + 1, kb);
+                        }
+                    });
+                }
+
+                for (int u = 0; u < numVertices; ++u) {
+                    if (table.distances[table.index(u, u)] < 0) {
+                        throw std::runtime_error("Graph contains a negative cycle");
+                    }
+                }
+                if (withPredecessors) {
+                    repairPredecessors(graph, table, numThreads);
+                }
+            }
+
+            // Turns every predecessor row left by blocked Floyd-Warshall into a tree rooted at its source. Each recorded
+            // predecessor ends a shortest path, but the tile order can leave the vertices around a zero-weight cycle pointing
+            // at each other instead of back to the source. Those vertices are re-attached to the rest of the row's tree in
+            // Dijkstra order of the reduced weights w(x, y) + d(x) - d(y), which are zero along shortest paths.
+            template <typename GraphType>
+            static void repairPredecessors(const GraphType& graph, DistanceTable<WeightType>& table, int numThreads) {
+                using Candidate = std::tuple<WeightType, int, int>;  // Reduced path length, vertex and its predecessor.
+                const WeightType none = std::numeric_limits<WeightType>::max();
+                int numVertices = table.numVertices;
+                int threads = std::min(numThreads, std::max(1, numVertices));
+                runParallel(threads, [&](int thread) {
+                    std::vector<char> state(numVertices);
+                    std::vector<WeightType> slack(numVertices); // Reduced length of the tree path to each attached vertex.
+                    std::vector<int> walk;
+                    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+                    for (int source = thread; source < numVertices; source += threads) {
+                        int* predecessors = table.predecessors.data() + table.index(source, 0);
+                        const WeightType* distances = table.row(source);
+                        std::fill(state.begin(), state.end(), Unknown);
+                        state[source] = Attached;
+                        bool anyDetached = false;
+                        for (int v = 0; v < numVertices; ++v) {
+                            if (distances[v] == none) {
+                                continue;
+                            }
+                            int at = v;
+                            while (state[at] == Unknown && predecessors[at] != -1) {
+                                state[at] = OnWalk;
+                                walk.push_back(at);
+                                at = predecessors[at];
+                            }
+                            char verdict = state[at] == Attached ? Attached : Detached;
+                            anyDetached = anyDetached || verdict == Detached;
+                            for (int walked : walk) {
+                                state[walked] = verdict;
+                            }
+                            walk.clear();
+                        }
+                        if (!anyDetached) {
+                            continue;
+                        }
+
+                        for (int x = 0; x < numVertices; ++x) {
+                            if (state[x] == Attached) {
+                                slack[x] = 0;
+                                pushDetachedNeighbors(graph, x, distances, slack, state, candidates);
+                            }
+                        }
+                        while (!candidates.empty()) {
+                            Candidate best = candidates.top();
+                            candidates.pop();
+                            int y = std::get<1>(best);
+                            if (state[y] != Detached) {
+                                continue;
+                            }
+                            state[y] = Attached;
+                            slack[y] = std::get<0>(best);
+                            predecessors[y] = std::get<2>(best);
+                            pushDetachedNeighbors(graph, y, distances, slack, state, candidates);
+                        }
+                    }
+                });
+            }
+
+            // Queues every edge from an attached vertex x to a detached vertex, keyed by the reduced length of the path through it.
+            template <typename GraphType, typename Queue>
+            static void pushDetachedNeighbors(const GraphType& graph, int x, const WeightType* distances, const std::vector<WeightType>& slack,
+                                              const std::vector<char>& state, Queue& candidates) {
+                for (const auto& edge : neighborsOf(graph, x)) {
+                    int y = edge.first;
+                    if (state[y] != Detached) {
+                        continue;
+                    }
+                    candidates.emplace(slack[x] + (distances[x] + edge.second - distances[y]), y, x);
+                }
+            }
+
+            // Relaxes tile (ib, jb) through every intermediate vertex of block kb, which lies in neither ib nor jb.
+            // The tiles read are not written in this phase, so the loops can run row by row: each target row segment
+            // stays in L1 cache while all BlockSize intermediate vertices are applied to it.
+            static void closeIndependentTile(DistanceTable<WeightType>& table, int ib, int jb, int kb) {
+                const WeightType none = std::numeric_limits<WeightType>::max();
+                bool withPredecessors = table.hasPredecessors();
+                for (int i = ib * BlockSize; i < (ib + 1) * BlockSize; ++i) {
+                    std::size_t first = table.index(i, jb * BlockSize);
+                    WeightType* target = table.distances.data() + first;
+                    int* predecessorRow = withPredecessors ? table.predecessors.data() + first : nullptr;
+                    const WeightType* viaRow = table.distances.data() + table.index(i, kb * BlockSize);
+                    for (int k = kb * BlockSize; k < (kb + 1) * BlockSize; ++k) {
+                        WeightType viaK = viaRow[k - kb * BlockSize];
+                        if (viaK == none) {
+                            continue;
+                        }
+                        std::size_t through = table.index(k, jb * BlockSize);
+                        minPlusRow(target, table.distances.data() + through, viaK, predecessorRow,
+                                   withPredecessors ? table.predecessors.data() + through : nullptr);
+                    }
+                }
+            }
+
+            // Relaxes tile (ib, jb) through every intermediate vertex of block kb.
+            // Used when the tile shares a row or column block with kb, so k must stay the outer loop as in plain Floyd-Warshall.
+            static void closeTile(DistanceTable<WeightType>& table, int ib, int jb, int kb) {
+                const WeightType none = std::numeric_limits<WeightType>::max();
+                bool withPredecessors = table.hasPredecessors();
+                for (int k = kb * BlockSize; k < (kb + 1) * BlockSize; ++k) {
+                    const WeightType* through = table.distances.data() + table.index(k, jb * BlockSize);
+                    const int* throughPredecessors = withPredecessors ? table.predecessors.data() + table.index(k, jb * BlockSize) : nullptr;
+                    for (int i = ib * BlockSize; i < (ib + 1) * BlockSize; ++i) {
+                        WeightType viaK = table.distances[table.index(i, k)];
+                        if (viaK == none) {
+                            continue;
+                        }
+                        std::size_t first = table.index(i, jb * BlockSize);
+                        int* predecessorRow = withPredecessors ? table.predecessors.data() + first : nullptr;
+                        minPlusRow(table.distances.data() + first, through, viaK, predecessorRow, throughPredecessors);
+                    }
+                }
+            }
+
+            // Lowers target[j] to base + through[j] for the BlockSize cells of a tile row, skipping unreachable through[j].
+            // Where a cell improves and predecessors are given, the cell takes the predecessor of the same target in k's row,
+            // so every row stays a tree: the path to j becomes the path to k followed by k's own path to j.
+            static void minPlusRow(WeightType* target, const WeightType* through, WeightType base, int* predecessors,
+                                   const int* throughPredecessors) {
+                const WeightType none = std::numeric_limits<WeightType>::max();
+#if defined(__AVX2__)
+                if constexpr (std::is_same<WeightType, double>::value) {
+                    __m256d baseVector = _mm256_set1_pd(base);
+                    if (predecessors == nullptr) {
+                        // Unreachable steps need no mask here: max plus any realistic finite base rounds back to max or infinity.
+                        for (int j = 0; j < BlockSize; j += 4) {
+                            __m256d candidates = _mm256_add_pd(baseVector, _mm256_loadu_pd(through + j));
+                            _mm256_storeu_pd(target + j, _mm256_min_pd(_mm256_loadu_pd(target + j), candidates));
+                        }
+                        return;
+                    }
+                    __m256d noneVector = _mm256_set1_pd(none);
+                    for (int j = 0; j < BlockSize; j += 4) {
+                        __m256d step = _mm256_loadu_pd(through + j);
+                        __m256d candidates = _mm256_add_pd(baseVector, step);
+                        __m256d current = _mm256_loadu_pd(target + j);
+                        __m256d better = _mm256_and_pd(_mm256_cmp_pd(step, noneVector, _CMP_NEQ_UQ), _mm256_cmp_pd(candidates, current, _CMP_LT_OQ));
+                        _mm256_storeu_pd(target + j, _mm256_blendv_pd(current, candidates, better));
+                        if (predecessors != nullptr) {
+                            copyPredecessors(predecessors, throughPredecessors, j, _mm256_movemask_pd(better));
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_same<WeightType, float>::value) {
+                    __m256 baseVector = _mm256_set1_ps(base);
+                    if (predecessors == nullptr) {
+                        for (int j = 0; j < BlockSize; j += 8) {
+                            __m256 candidates = _mm256_add_ps(baseVector, _mm256_loadu_ps(through + j));
+                            _mm256_storeu_ps(target + j, _mm256_min_ps(_mm256_loadu_ps(target + j), candidates));
+                        }
+                        return;
+                    }
+                    __m256 noneVector = _mm256_set1_ps(none);
+                    for (int j = 0; j < BlockSize; j += 8) {
+                        __m256 step = _mm256_loadu_ps(through + j);
+                        __m256 candidates = _mm256_add_ps(baseVector, step);
+                        __m256 current = _mm256_loadu_ps(target + j);
+                        __m256 better = _mm256_and_ps(_mm256_cmp_ps(step, noneVector, _CMP_NEQ_UQ), _mm256_cmp_ps(candidates, current, _CMP_LT_OQ));
+                        _mm256_storeu_ps(target + j, _mm256_blendv_ps(current, candidates, better));
+                        if (predecessors != nullptr) {
+                            copyPredecessors(predecessors, throughPredecessors, j, _mm256_movemask_ps(better));
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 4) {
+                    __m256i baseVector = _mm256_set1_epi32(base);
+                    __m256i noneVector = _mm256_set1_epi32(none);
+                    for (int j = 0; j < BlockSize; j += 8) {
+                        __m256i step = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(through + j));
+                        __m256i candidates = _mm256_add_epi32(baseVector, step); // Wraps for unreachable cells, which are masked out.
+                        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + j));
+                        __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi32(step, noneVector), _mm256_cmpgt_epi32(current, candidates));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + j), _mm256_blendv_epi8(current, candidates, better));
+                        if (predecessors != nullptr) {
+                            copyPredecessors(predecessors, throughPredecessors, j, _mm256_movemask_ps(_mm256_castsi256_ps(better)));
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 8) {
+                    __m256i baseVector = _mm256_set1_epi64x(base);
+                    __m256i noneVector = _mm256_set1_epi64x(none);
+                    for (int j = 0; j < BlockSize; j += 4) {
+                        __m256i step = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(through + j));
+                        __m256i candidates = _mm256_add_epi64(baseVector, step);
+                        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + j));
+                        __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi64(step, noneVector), _mm256_cmpgt_epi64(current, candidates));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + j), _mm256_blendv_epi8(current, candidates, better));
+                        if (predecessors != nullptr) {
+                            copyPredecessors(predecessors, throughPredecessors, j, _mm256_movemask_pd(_mm256_castsi256_pd(better)));
+                        }
+                    }
+                    return;
+                }
+#endif
+                for (int j = 0; j < BlockSize; ++j) {
+                    if (through[j] != none) {
+                        WeightType candidate = base + through[j];
+                        if (candidate < target[j]) {
+                            target[j] = candidate;
+                            if (predecessors != nullptr) {
+                                predecessors[j] = throughPredecessors[j];
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Copies the predecessor of every lane set in a relaxation mask, starting at cell first, from k's row.
+            static void copyPredecessors(int* predecessors, const int* throughPredecessors, int first, int mask) {
+                for (int lane = 0; mask != 0; ++lane, mask >>= 1) {
+                    if (mask & 1) {
+                        predecessors[first + lane] = throughPredecessors[first + lane];
+                    }
+                }
+            }
+
+            // Johnson's algorithm: Dijkstra from every source over a non-negative (reweighted if necessary) CSR copy.
+            template <typename GraphType>
+            static void johnson(const GraphType& graph, DistanceTable<WeightType>& table, int numThreads) {
+                int numVertices = table.numVertices;
+                std::vector<VertexType> vertices;
+                std::vector<int> offsets(numVertices + 1, 0);
+                std::vector<int> targets;
+                std::vector<WeightType> weights;
+                bool hasNegative = false;
+                for (int u = 0; u < numVertices; ++u) {
+                    vertices.push_back(graph.getVertex(u));
+                    for (const auto& edge : neighborsOf(graph, u)) {
+                        targets.push_back(edge.first);
+                        weights.push_back(edge.second);
+                        hasNegative = hasNegative || edge.second < 0;
+                    }
+                    offsets[u + 1] = static_cast<int>(targets.size());
+                }
+
+                // Potentials from Bellman-Ford off a virtual source joined to every vertex by a zero-weight edge; reweighting
+                // each edge (u, v) to w + h(u) - h(v) makes every weight non-negative while preserving shortest paths.
+                std::vector<WeightType> potentials(numVertices, 0);
+                if (hasNegative) {
+                    bool changed = true;
+                    for (int round = 0; changed; ++round) {
+                        if (round == numVertices + 1) {
+                            throw std::runtime_error("Graph contains a negative cycle");
+                        }
+                        changed = false;
+                        for (int u = 0; u < numVertices; ++u) {
+                            for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                                if (potentials[u] + weights[i] < potentials[targets[i]]) {
+                                    potentials[targets[i]] = potentials[u] + weights[i];
+                                    changed = true;
+                                }
+                            }
+                        }
+                    }
+                    for (int u = 0; u < numVertices; ++u) {
+                        for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                            weights[i] += potentials[u] - potentials[targets[i]];
+                        }
+                    }
+                }
+                GraphCSR<VertexType, WeightType> reweighted(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+
+                int threads = std::min(numThreads, std::max(1, numVertices));
+                runParallel(threads, [&](int thread) {
+                    for (int source = thread; source < numVertices; source += threads) {
+                        SSSP::ShortestPathTree<WeightType> tree = SSSP::Dijkstra<VertexType, WeightType>::shortestPathTree(reweighted, source);
+                        WeightType* row = table.distances.data() + table.index(source, 0);
+                        for (int v = 0; v < numVertices; ++v) {
+                            if (tree.distances[v] != std::numeric_limits<WeightType>::max()) {
+                                row[v] = tree.distances[v] - potentials[source] + potentials[v];
+                            }
+                        }
+                        if (table.hasPredecessors()) {
+                            std::copy(tree.previous.begin(), tree.previous.end(), table.predecessors.begin() + table.index(source, 0));
+                        }
+                    }
+                });
+            }
+        };
+
+    } // namespace APSP
+} // namespace GraphAlgorithm
+
+#endif // ALLPAIRS_H
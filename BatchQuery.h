@@ -0,0 +1,180 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef BATCHQUERY_H
+#define BATCHQUERY_H
+
+#include "GraphAlgorithm.h"
+#include "Parallel.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+
+namespace GraphAlgorithm {
+    namespace SSSP {
+
+        // Class answering batches of independent point-to-point queries with Dijkstra's algorithm on a pool of worker threads.
+        // The workers are started once and kept for the lifetime of the engine. Each owns a DijkstraWorkspace that persists
+        // across batches, so steady-state queries allocate nothing but their result paths. The graph is only read, so one
+        // const graph is shared by all workers without locking. Queries are handed out in small chunks through an atomic
+        // counter, which balances uneven query costs across workers.
+        // With SearchStats as StatsType, each worker's workspace records its queries' statistics; statistics() sums them.
+        template <typename VertexType, typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type,
+                  typename StatsType = NoStats>
+        class BatchQuery {
+        public:
+            using Search = Dijkstra<VertexType, WeightType, QueueType, StatsType>;
+            using Workspace = typename Search::Workspace;
+
+            // Number of consecutive queries a worker claims at a time.
+            static constexpr int ChunkSize = 16;
+
+            // Constructor starts numWorkers worker threads; zero uses one worker per hardware thread.
+            explicit BatchQuery(int numWorkers = 0) : stopping(false), batchGeneration(0), activeWorkers(0) {
+                numWorkers = resolveThreadCount(numWorkers);
+                workspaces.resize(numWorkers);
+                workers.reserve(numWorkers);
+                for (int i = 0; i < numWorkers; ++i) {
+                    workers.emplace_back(&BatchQuery::workerLoop, this, i);
+                }
+            }
+
+            // The engine owns running threads, so it can be neither copied nor moved.
+            BatchQuery(const BatchQuery&) = delete;
+            BatchQuery& operator=(const BatchQuery&) = delete;
+
+            // Destructor stops and joins all worker threads.
+            ~BatchQuery() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stopping = true;
+                }
+                wakeWorkers.notify_all();
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+
+            // Returns the number of worker threads.
+            int workerCount() const {
+                return static_cast<int>(workers.size());
+            }
+
+            // Answers every (source, destination) pair and returns the shortest paths in input order.
+            // Blocks until the whole batch is done. Concurrent calls on the same engine are serialized.
+            template <typename GraphType>
+            std::vector<ShortestPath<WeightType>> execute(const GraphType& graph, const std::vector<std::pair<int, int>>& queries) {
+                int numVertices = graph.vertexCount();
+                for (const auto& query : queries) {
+                    if (query.first < 0 || query.first >= numVertices || query.second < 0 || query.second >= numVertices) {
+                        throw std::out_of_range("Query vertex out of range");
+                    }
+                }
+
+                std::vector<ShortestPath<WeightType>> results(queries.size());
+                std::atomic<int> next(0);
+                int numQueries = static_cast<int>(queries.size());
+                // Each worker claims chunks of queries until none are left, writing each result into its own slot.
+                auto job = [&graph, &queries, &results, &next, numQueries](Workspace& workspace) {
+                    while (true) {
+                        int first = next.fetch_add(ChunkSize, std::memory_order_relaxed);
+                        if (first >= numQueries) {
+                            break;
+                        }
+                        int last = first + ChunkSize < numQueries ? first + ChunkSize : numQueries;
+                        for (int i = first; i < last; ++i) {
+                            results[i] = Search::execute(graph, queries[i].first, queries[i].second, workspace);
+                        }
+                    }
+                };
+
+                std::lock_guard<std::mutex> batchLock(batchMutex);
+                run(job);
+                return results;
+            }
+
+            // Returns the statistics of every query answered so far, summed over all workers. Requires an enabled StatsType.
+            StatsType statistics() {
+                std::lock_guard<std::mutex> batchLock(batchMutex);
+                StatsType total;
+                for (const auto& workspace : workspaces) {
+                    total += workspace.stats();
+                }
+                return total;
+            }
+
+            // Clears the statistics of all workers.
+            void resetStatistics() {
+                std::lock_guard<std::mutex> batchLock(batchMutex);
+                for (auto& workspace : workspaces) {
+                    workspace.stats().reset();
+                }
+            }
+
+        private:
+            std::vector<std::thread> workers;     // Worker threads, one per workspace.
+            std::vector<Workspace> workspaces;    // Per-worker search state, reused across batches.
+            std::mutex batchMutex;                // Serializes concurrent execute() calls.
+            std::mutex mutex;                     // Guards the fields below.
+            std::condition_variable wakeWorkers;  // Signals a new batch or shutdown to the workers.
+            std::condition_variable batchDone;    // Signals the caller when the last worker finishes a batch.
+            std::function<void(Workspace&)> job;  // Work of the current batch.
+            std::exception_ptr failure;           // First exception thrown by a worker in the current batch.
+            bool stopping;                        // Set when the engine is being destroyed.
+            unsigned int batchGeneration;         // Incremented for every batch so workers can tell batches apart.
+            int activeWorkers;                    // Workers that have not finished the current batch.
+
+            // Publishes a job to all workers and waits until every worker has finished it.
+            void run(std::function<void(Workspace&)> batchJob) {
+                std::unique_lock<std::mutex> lock(mutex);
+                job = std::move(batchJob);
+                failure = nullptr;
+                activeWorkers = workerCount();
+                ++batchGeneration;
+                wakeWorkers.notify_all();
+                batchDone.wait(lock, [this] { return activeWorkers == 0; });
+                job = nullptr;
+                if (failure) {
+                    std::rethrow_exception(failure);
+                }
+            }
+
+            // Body of each worker thread: wait for a batch, run it with this worker's workspace, report completion.
+            void workerLoop(int index) {
+                unsigned int seenGeneration = 0;
+                while (true) {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        wakeWorkers.wait(lock, [this, seenGeneration] { return stopping || batchGeneration != seenGeneration; });
+                        if (stopping) {
+                            return;
+                        }
+                        seenGeneration = batchGeneration;
+                    }
+
+                    try {
+                        job(workspaces[index]);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!failure) {
+                            failure = std::current_exception();
+                        }
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (--activeWorkers == 0) {
+                        batchDone.notify_one();
+                    }
+                }
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // BATCHQUERY_H
@@ -0,0 +1,589 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#include "GraphAdjacencyList.h"
+#include "GraphAdjacencyMatrix.h"
+#include "GraphCSR.h"
+#include "MappedGraph.h"
+#include "GraphImporter.h"
+#include "GraphGenerator.h"
+#include "GraphAlgorithm.h"
+#include "ContractionHierarchy.h"
+#include "DynamicDijkstra.h"
+#include "SearchStats.h"
+#include "VertexReordering.h"
+#include "SnapshotGraph.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <sys/resource.h>
+
+// Shorthand types for vertices and weights. Integral weights let every queue policy, Dial's buckets included, take part.
+using VertexType = int;
+using WeightType = int;
+
+// Benchmark settings, filled from the command line.
+struct Options {
+    std::string shape = "grid";   // Generated graph shape: "grid", "random", "rmat" or "geometric".
+    int vertices = 10000;         // Number of generated vertices (rounded down to a square for grids).
+    int degree = 4;               // Average out-degree of random graphs.
+    WeightType maxWeight = 100;   // Generated edge weights are drawn from [1, maxWeight].
+    int queries = 1000;           // Number of point-to-point queries per benchmark.
+    unsigned int seed = 1;        // Seed of the graph and query generators.
+    std::string dimacsPath;       // DIMACS file to load instead of generating a graph.
+    std::string edgeListPath;     // Edge-list file to load instead of generating a graph.
+    int matrixLimit = 4096;       // Largest graph the O(V^2) adjacency matrix is benchmarked on.
+    bool runHierarchy = true;     // Whether to build and query a contraction hierarchy.
+    std::string format = "csv";   // Output format: "csv" or "json".
+    std::string outputPath;       // Output file; standard output if empty.
+    std::string statsPath;        // Search statistics file; no statistics are gathered if empty.
+    std::string statsFormat = "json"; // Statistics format: "json" or "prometheus".
+};
+
+// Measurements of one benchmark.
+struct Result {
+    std::string algorithm;   // Search algorithm.
+    std::string backend;     // Graph representation searched.
+    std::string queue;       // Priority queue policy.
+    int vertices;            // Vertices in the graph.
+    long long edges;         // Edges in the graph.
+    int queries;             // Queries answered.
+    double setupMs;          // Time to build the backend or preprocess, in milliseconds.
+    double queriesPerSecond; // Throughput over the whole query set.
+    double p50Us;            // Median query latency in microseconds.
+    double p90Us;            // 90th percentile query latency in microseconds.
+    double p99Us;            // 99th percentile query latency in microseconds.
+    double maxUs;            // Slowest query in microseconds.
+    double settledPerQuery;  // Average number of vertices settled per query.
+    double settledPerSecond; // Vertices settled per second over the whole query set.
+    long peakRssKb;          // Peak resident set size of the process so far, in kilobytes.
+    long long distanceChecksum; // Sum of the path lengths found, counting an unreachable destination as -1.
+    std::string check;       // "ok" or "mismatch" against the reference row, or "n/a" for rows that are not compared.
+};
+
+// Work and answer of one benchmarked query.
+struct QueryOutcome {
+    int settled;        // Vertices settled by the query.
+    long long distance; // Length of the path found, or -1 if the destination is unreachable.
+};
+
+// Returns the outcome of a query from the vertices it settled and the path it found.
+QueryOutcome outcomeOf(int settled, const GraphAlgorithm::SSSP::ShortestPath<WeightType>& path) {
+    return {settled, path.reachable ? static_cast<long long>(path.totalWeight) : -1};
+}
+
+// Search statistics of one Dijkstra benchmark, gathered in a separate untimed pass so the timings stay uninstrumented.
+struct StatsRow {
+    std::string backend;                       // Graph representation searched.
+    std::string queue;                         // Priority queue policy.
+    GraphAlgorithm::SSSP::SearchStats stats;   // Totals over the whole query set.
+};
+
+// Returns the peak resident set size of the process in kilobytes.
+long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss; // Reported in kilobytes on Linux.
+}
+
+// Returns the milliseconds elapsed since start.
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Prints the command-line usage.
+void printUsage() {
+    std::cerr << "Usage: Benchmark [options]\n"
+              << "  --shape grid|random|rmat|geometric\n"
+              << "                          generated graph shape (default grid)\n"
+              << "  --vertices N            generated vertex count (default 10000)\n"
+              << "  --degree D              average out-degree of random, rmat and geometric graphs (default 4)\n"
+              << "  --max-weight W          edge weights are drawn from [1, W] (default 100)\n"
+              << "  --queries Q             queries per benchmark (default 1000)\n"
+              << "  --seed S                graph and query seed (default 1)\n"
+              << "  --dimacs FILE           load a DIMACS .gr file instead of generating a graph\n"
+              << "  --edges FILE            load a 0-based edge list instead of generating a graph\n"
+              << "  --matrix-limit N        skip the adjacency matrix above N vertices (default 4096)\n"
+              << "  --no-ch                 skip the contraction hierarchy\n"
+              << "  --format csv|json       output format (default csv)\n"
+              << "  --output FILE           write results to FILE instead of standard output\n"
+              << "  --stats FILE            also write Dijkstra search statistics (queue and relaxation counts, phase times) to FILE\n"
+              << "  --stats-format json|prometheus\n"
+              << "                          statistics format (default json)\n";
+}
+
+// Parses the command line into options; throws std::invalid_argument on bad input.
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string flag = argv[i];
+        // Returns the value following the current flag.
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Missing value for " + flag);
+            }
+            return argv[++i];
+        };
+        if (flag == "--shape") {
+            options.shape = value();
+        } else if (flag == "--vertices") {
+            options.vertices = std::stoi(value());
+        } else if (flag == "--degree") {
+            options.degree = std::stoi(value());
+        } else if (flag == "--max-weight") {
+            options.maxWeight = std::stoi(value());
+        } else if (flag == "--queries") {
+            options.queries = std::stoi(value());
+        } else if (flag == "--seed") {
+            options.seed = static_cast<unsigned int>(std::stoul(value()));
+        } else if (flag == "--dimacs") {
+            options.dimacsPath = value();
+        } else if (flag == "--edges") {
+            options.edgeListPath = value();
+        } else if (flag == "--matrix-limit") {
+            options.matrixLimit = std::stoi(value());
+        } else if (flag == "--no-ch") {
+            options.runHierarchy = false;
+        } else if (flag == "--format") {
+            options.format = value();
+        } else if (flag == "--output") {
+            options.outputPath = value();
+        } else if (flag == "--stats") {
+            options.statsPath = value();
+        } else if (flag == "--stats-format") {
+            options.statsFormat = value();
+        } else {
+            throw std::invalid_argument("Unknown option " + flag);
+        }
+    }
+    if (options.shape != "random" && options.shape != "grid" && options.shape != "rmat" && options.shape != "geometric") {
+        throw std::invalid_argument("Unknown shape " + options.shape);
+    }
+    if (options.format != "csv" && options.format != "json") {
+        throw std::invalid_argument("Unknown format " + options.format);
+    }
+    if (options.statsFormat != "json" && options.statsFormat != "prometheus") {
+        throw std::invalid_argument("Unknown statistics format " + options.statsFormat);
+    }
+    if (options.vertices < 2 || options.degree < 0 || options.maxWeight < 1 || options.queries < 1) {
+        throw std::invalid_argument("Sizes must be positive");
+    }
+    return options;
+}
+
+// Copies any graph into an adjacency list.
+template <typename GraphType>
+void copyGraph(const GraphType& source, GraphAdjacencyList<VertexType, WeightType>& graph) {
+    for (int v = 0; v < source.vertexCount(); ++v) {
+        graph.addVertex(source.getVertex(v));
+    }
+    for (int u = 0; u < source.vertexCount(); ++u) {
+        for (const auto& edge : source.edges(u)) {
+            graph.addEdge(u, edge.first, edge.second);
+        }
+    }
+}
+
+// Generates the benchmark graph from a fixed seed, so every run sees the same edges.
+// Geometric graphs also report the position of every vertex in coordinates.
+void generateGraph(GraphAdjacencyList<VertexType, WeightType>& graph, const Options& options,
+                   std::vector<std::pair<double, double>>& coordinates) {
+    using Generator = GraphGenerator<VertexType, WeightType>;
+    if (options.shape == "grid") {
+        // Square grid with an edge in both directions between horizontal and vertical neighbours.
+        int side = static_cast<int>(std::sqrt(static_cast<double>(options.vertices)));
+        copyGraph(Generator::grid(side, side, 1, options.maxWeight, options.seed), graph);
+    } else if (options.shape == "rmat") {
+        // Power-law graph over the largest power of two not above the requested vertex count.
+        int scale = 1;
+        while ((2 << scale) <= options.vertices && scale < 30) {
+            ++scale;
+        }
+        copyGraph(Generator::rmat(scale, static_cast<long long>(options.degree) << scale, 1, options.maxWeight, options.seed), graph);
+    } else if (options.shape == "geometric") {
+        copyGraph(Generator::geometric(options.vertices, options.degree, options.maxWeight, options.seed, 0, &coordinates), graph);
+    } else {
+        // Uniformly random edges without self-loops, inserted one at a time.
+        std::mt19937 gen(options.seed);
+        std::uniform_int_distribution<WeightType> weightDist(1, options.maxWeight);
+        std::uniform_int_distribution<int> vertexDist(0, options.vertices - 1);
+        for (int i = 0; i < options.vertices; ++i) {
+            graph.addVertex(static_cast<VertexType>(i));
+        }
+        long long numEdges = static_cast<long long>(options.vertices) * options.degree;
+        for (long long i = 0; i < numEdges; ++i) {
+            int u = vertexDist(gen);
+            int v = vertexDist(gen);
+            if (u != v) {
+                graph.addEdge(u, v, weightDist(gen));
+            }
+        }
+    }
+}
+
+// Times every query with runQuery(source, destination), which reports the vertices it settled and the distance it found.
+// The distances are summed into a checksum that main() compares across rows.
+Result measure(const std::string& algorithm, const std::string& backend, const std::string& queue, int vertices, long long edges,
+               double setupMs, const std::vector<std::pair<int, int>>& queries,
+               const std::function<QueryOutcome(int, int)>& runQuery) {
+    std::vector<double> latencies;
+    latencies.reserve(queries.size());
+    long long settled = 0;
+    long long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& query : queries) {
+        auto queryStart = std::chrono::steady_clock::now();
+        QueryOutcome outcome = runQuery(query.first, query.second);
+        latencies.push_back(elapsedMs(queryStart) * 1000);
+        settled += outcome.settled;
+        checksum += outcome.distance;
+    }
+    double totalMs = elapsedMs(start);
+    std::sort(latencies.begin(), latencies.end());
+
+    // Returns the latency at the given percentile (nearest rank).
+    auto percentile = [&latencies](double p) {
+        std::size_t rank = static_cast<std::size_t>(std::ceil(p / 100 * latencies.size()));
+        return latencies[rank == 0 ? 0 : rank - 1];
+    };
+
+    Result result;
+    result.algorithm = algorithm;
+    result.backend = backend;
+    result.queue = queue;
+    result.vertices = vertices;
+    result.edges = edges;
+    result.queries = static_cast<int>(queries.size());
+    result.setupMs = setupMs;
+    result.queriesPerSecond = totalMs > 0 ? queries.size() / (totalMs / 1000) : 0;
+    result.p50Us = percentile(50);
+    result.p90Us = percentile(90);
+    result.p99Us = percentile(99);
+    result.maxUs = latencies.back();
+    result.settledPerQuery = static_cast<double>(settled) / queries.size();
+    result.settledPerSecond = totalMs > 0 ? settled / (totalMs / 1000) : 0;
+    result.peakRssKb = peakRssKb();
+    result.distanceChecksum = checksum;
+    std::cerr << algorithm << "/" << backend << "/" << queue << ": " << result.queriesPerSecond << " queries/s" << std::endl;
+    return result;
+}
+
+// Benchmarks Dijkstra's algorithm with one queue policy on one backend.
+// If statsRows is given, the query set is then run once more with statistics enabled and the totals are appended to it.
+template <typename QueueType, typename GraphType>
+Result benchmarkDijkstra(const GraphType& graph, const std::string& backend, const std::string& queue, long long edges, double setupMs,
+                         const std::vector<std::pair<int, int>>& queries, std::vector<StatsRow>* statsRows) {
+    using Search = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType, QueueType>;
+    typename Search::Workspace workspace;
+    Result result = measure("dijkstra", backend, queue, graph.vertexCount(), edges, setupMs, queries, [&](int source, int destination) {
+        auto path = Search::execute(graph, source, destination, workspace);
+        return outcomeOf(workspace.settledCount(), path);
+    });
+    if (statsRows) {
+        using InstrumentedSearch = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType, QueueType, GraphAlgorithm::SSSP::SearchStats>;
+        typename InstrumentedSearch::Workspace instrumented;
+        for (const auto& query : queries) {
+            InstrumentedSearch::execute(graph, query.first, query.second, instrumented);
+        }
+        statsRows->push_back({backend, queue, instrumented.stats()});
+    }
+    return result;
+}
+
+// Benchmarks the array-scan dense Dijkstra on one backend.
+template <typename GraphType>
+Result benchmarkDense(const GraphType& graph, const std::string& backend, long long edges, double setupMs,
+                      const std::vector<std::pair<int, int>>& queries) {
+    using Search = GraphAlgorithm::SSSP::DenseDijkstra<VertexType, WeightType>;
+    typename Search::Workspace workspace;
+    return measure("dijkstra-dense", backend, "none", graph.vertexCount(), edges, setupMs, queries, [&](int source, int destination) {
+        auto path = Search::execute(graph, source, destination, workspace);
+        return outcomeOf(workspace.settledCount(), path);
+    });
+}
+
+// Writes the results as CSV with a header row.
+void writeCsv(std::ostream& out, const std::vector<Result>& results) {
+    out << "algorithm,backend,queue,vertices,edges,queries,setup_ms,queries_per_sec,p50_us,p90_us,p99_us,max_us,settled_per_query,settled_per_sec,peak_rss_kb,distance_checksum,check\n";
+    for (const Result& r : results) {
+        out << r.algorithm << ',' << r.backend << ',' << r.queue << ',' << r.vertices << ',' << r.edges << ',' << r.queries << ','
+            << r.setupMs << ',' << r.queriesPerSecond << ',' << r.p50Us << ',' << r.p90Us << ',' << r.p99Us << ',' << r.maxUs << ','
+            << r.settledPerQuery << ',' << r.settledPerSecond << ',' << r.peakRssKb << ',' << r.distanceChecksum << ',' << r.check << '\n';
+    }
+}
+
+// Writes the results as a JSON array of objects.
+void writeJson(std::ostream& out, const std::vector<Result>& results) {
+    out << "[\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << "  {\"algorithm\": \"" << r.algorithm << "\", \"backend\": \"" << r.backend << "\", \"queue\": \"" << r.queue << "\", "
+            << "\"vertices\": " << r.vertices << ", \"edges\": " << r.edges << ", \"queries\": " << r.queries << ", "
+            << "\"setup_ms\": " << r.setupMs << ", \"queries_per_sec\": " << r.queriesPerSecond << ", "
+            << "\"p50_us\": " << r.p50Us << ", \"p90_us\": " << r.p90Us << ", \"p99_us\": " << r.p99Us << ", \"max_us\": " << r.maxUs << ", "
+            << "\"settled_per_query\": " << r.settledPerQuery << ", \"settled_per_sec\": " << r.settledPerSecond << ", "
+            << "\"peak_rss_kb\": " << r.peakRssKb << ", \"distance_checksum\": " << r.distanceChecksum << ", \"check\": \"" << r.check << "\"}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+}
+
+// Writes the search statistics in the chosen format, labelled by backend and queue.
+void writeStats(std::ostream& out, const std::string& format, const std::vector<StatsRow>& rows) {
+    if (format == "prometheus") {
+        std::vector<std::pair<std::string, GraphAlgorithm::SSSP::SearchStats>> series;
+        for (const StatsRow& row : rows) {
+            series.emplace_back("algorithm=\"dijkstra\",backend=\"" + row.backend + "\",queue=\"" + row.queue + "\"", row.stats);
+        }
+        GraphAlgorithm::SSSP::SearchStats::writePrometheusSeries(out, series);
+        return;
+    }
+    out << "[\n";
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        out << "  {\"algorithm\": \"dijkstra\", \"backend\": \"" << rows[i].backend << "\", \"queue\": \"" << rows[i].queue << "\", \"stats\": ";
+        rows[i].stats.writeJson(out);
+        out << (i + 1 < rows.size() ? "},\n" : "}\n");
+    }
+    out << "]\n";
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    // Build the adjacency list first: every other backend is derived from it, so all of them hold the same edges.
+    GraphAdjacencyList<VertexType, WeightType> graphList;
+    std::vector<std::pair<double, double>> coordinates; // Vertex positions, known for geometric graphs only.
+    auto start = std::chrono::steady_clock::now();
+    if (!options.dimacsPath.empty() || !options.edgeListPath.empty()) {
+        GraphCSR<VertexType, WeightType> imported = options.dimacsPath.empty()
+            ? GraphImporter<VertexType, WeightType>::readEdgeList(options.edgeListPath)
+            : GraphImporter<VertexType, WeightType>::readDimacs(options.dimacsPath);
+        copyGraph(imported, graphList);
+    } else {
+        generateGraph(graphList, options, coordinates);
+    }
+    double listMs = elapsedMs(start);
+    int numVertices = graphList.vertexCount();
+    if (numVertices == 0) {
+        std::cerr << "The graph has no vertices" << std::endl;
+        return 1;
+    }
+
+    start = std::chrono::steady_clock::now();
+    GraphCSR<VertexType, WeightType> graphCSR(graphList);
+    double csrMs = elapsedMs(start);
+    long long numEdges = graphCSR.edgeCount();
+
+    // Fixed-seed query set shared by every benchmark.
+    std::mt19937 queryGen(options.seed + 1);
+    std::uniform_int_distribution<int> vertexDist(0, numVertices - 1);
+    std::vector<std::pair<int, int>> queries(options.queries);
+    for (auto& query : queries) {
+        query = {vertexDist(queryGen), vertexDist(queryGen)};
+    }
+
+    using DefaultQueueType = GraphAlgorithm::SSSP::DefaultQueue<WeightType>::type;
+    std::vector<Result> results;
+    std::vector<StatsRow> statsRows;
+    std::vector<StatsRow>* collectStats = options.statsPath.empty() ? nullptr : &statsRows;
+
+    // Dijkstra with the default queue on every backend.
+    results.push_back(benchmarkDijkstra<DefaultQueueType>(graphList, "adjacency-list", "default", numEdges, listMs, queries, collectStats));
+    if (numVertices <= options.matrixLimit) {
+        start = std::chrono::steady_clock::now();
+        GraphAdjacencyMatrix<VertexType, WeightType> graphMatrix(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            graphMatrix.addVertex(graphList.getVertex(v));
+        }
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : graphCSR.edges(u)) {
+                graphMatrix.addEdge(u, edge.first, edge.second);
+            }
+        }
+        double matrixMs = elapsedMs(start);
+        results.push_back(benchmarkDijkstra<DefaultQueueType>(graphMatrix, "adjacency-matrix", "default", numEdges, matrixMs, queries, collectStats));
+        results.push_back(benchmarkDense(graphMatrix, "adjacency-matrix", numEdges, matrixMs, queries));
+    } else {
+        std::cerr << "Skipping the adjacency matrix: " << numVertices << " vertices exceed --matrix-limit" << std::endl;
+    }
+    results.push_back(benchmarkDijkstra<DefaultQueueType>(graphCSR, "csr", "default", numEdges, csrMs, queries, collectStats));
+    {
+        // Compact CSR: 32-bit unsigned targets and 16-bit fixed-point weights, exact while weights stay below 65536.
+        start = std::chrono::steady_clock::now();
+        GraphCSR<VertexType, WeightType, std::uint32_t, FixedPointWeights<WeightType>> graphCompact(graphCSR);
+        double compactMs = elapsedMs(start);
+        results.push_back(benchmarkDijkstra<DefaultQueueType>(graphCompact, "csr-compact", "default", numEdges, compactMs, queries, collectStats));
+        WeightType maxWeight = 0;
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : graphCSR.edges(u)) {
+                maxWeight = std::max(maxWeight, edge.second);
+            }
+        }
+        if (maxWeight > std::numeric_limits<std::uint16_t>::max()) {
+            results.back().check = "n/a"; // Rounded weights change the distances.
+        }
+    }
+    {
+        std::string mappedPath = "Benchmark.graph";
+        start = std::chrono::steady_clock::now();
+        MappedGraph<VertexType, WeightType>::write(graphCSR, mappedPath);
+        MappedGraph<VertexType, WeightType> graphMapped(mappedPath);
+        double mappedMs = elapsedMs(start);
+        results.push_back(benchmarkDijkstra<DefaultQueueType>(graphMapped, "mapped", "default", numEdges, mappedMs, queries, collectStats));
+        std::remove(mappedPath.c_str());
+    }
+    {
+        // Copy-on-write blocks searched through a pinned snapshot, as readers do while a writer mutates the graph.
+        start = std::chrono::steady_clock::now();
+        SnapshotGraph<VertexType, WeightType> graphSnapshot;
+        for (int v = 0; v < numVertices; ++v) {
+            graphSnapshot.addVertex(graphList.getVertex(v));
+        }
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : graphCSR.edges(u)) {
+                graphSnapshot.addEdge(u, edge.first, edge.second);
+            }
+        }
+        graphSnapshot.publish();
+        double snapshotMs = elapsedMs(start);
+        SnapshotGraph<VertexType, WeightType>::Reader reader(graphSnapshot);
+        results.push_back(benchmarkDijkstra<DefaultQueueType>(reader.pin(), "snapshot", "default", numEdges, snapshotMs, queries, collectStats));
+    }
+
+    // Dijkstra on the CSR relabelled for locality; queries and paths stay in the original ids. Setup includes the CSR
+    // build and the reordering. Compare settled_per_sec with the plain csr row.
+    {
+        using Reordering = VertexReordering<VertexType, WeightType>;
+        std::vector<std::pair<std::string, std::function<VertexPermutation()>>> orders = {
+            {"csr-bfs", [&] { return Reordering::bfs(graphCSR); }},
+            {"csr-rcm", [&] { return Reordering::reverseCuthillMcKee(graphCSR); }},
+        };
+        if (!coordinates.empty()) {
+            orders.push_back({"csr-hilbert", [&] { return Reordering::hilbert(coordinates); }});
+        }
+        for (const auto& order : orders) {
+            start = std::chrono::steady_clock::now();
+            ReorderedGraph<VertexType, WeightType> reordered(graphCSR, order.second());
+            double reorderMs = csrMs + elapsedMs(start);
+            ReorderedGraph<VertexType, WeightType>::Workspace workspace;
+            results.push_back(measure("dijkstra", order.first, "default", numVertices, numEdges, reorderMs, queries, [&](int source, int destination) {
+                auto path = reordered.execute(source, destination, workspace);
+                return outcomeOf(workspace.settledCount(), path);
+            }));
+        }
+    }
+
+    results.push_back(benchmarkDense(graphCSR, "csr", numEdges, csrMs, queries));
+
+    // Every queue policy on the CSR backend.
+    results.push_back(benchmarkDijkstra<IndexedDaryHeap<WeightType, 2>>(graphCSR, "csr", "binary-heap", numEdges, csrMs, queries, collectStats));
+    results.push_back(benchmarkDijkstra<IndexedDaryHeap<WeightType, 4>>(graphCSR, "csr", "4-ary-heap", numEdges, csrMs, queries, collectStats));
+    results.push_back(benchmarkDijkstra<GraphAlgorithm::SSSP::LazyMinHeapQueue<WeightType>>(graphCSR, "csr", "lazy-min-heap", numEdges, csrMs, queries, collectStats));
+    results.push_back(benchmarkDijkstra<DialBucketQueue<WeightType>>(graphCSR, "csr", "dial-buckets", numEdges, csrMs, queries, collectStats));
+    results.push_back(benchmarkDijkstra<RadixHeap<WeightType>>(graphCSR, "csr", "radix-heap", numEdges, csrMs, queries, collectStats));
+
+    // Bidirectional Dijkstra over the CSR and its transpose.
+    {
+        using Search = GraphAlgorithm::SSSP::BidirectionalDijkstra<VertexType, WeightType>;
+        start = std::chrono::steady_clock::now();
+        GraphCSR<VertexType, WeightType> reverseCSR = GraphCSR<VertexType, WeightType>::reversed(graphCSR);
+        double reverseMs = csrMs + elapsedMs(start);
+        Search::Workspace workspace;
+        results.push_back(measure("bidirectional", "csr", "default", numVertices, numEdges, reverseMs, queries, [&](int source, int destination) {
+            auto path = Search::execute(graphCSR, reverseCSR, source, destination, workspace);
+            return outcomeOf(workspace.forward.settledCount() + workspace.backward.settledCount(), path);
+        }));
+    }
+
+    // Contraction hierarchy queries; setup is the preprocessing time.
+    if (options.runHierarchy) {
+        using Hierarchy = GraphAlgorithm::SSSP::ContractionHierarchy<VertexType, WeightType>;
+        start = std::chrono::steady_clock::now();
+        Hierarchy hierarchy(graphCSR);
+        double hierarchyMs = elapsedMs(start);
+        Hierarchy::Workspace workspace;
+        results.push_back(measure("contraction-hierarchy", "csr", "default", numVertices, numEdges, hierarchyMs, queries, [&](int source, int destination) {
+            auto path = hierarchy.execute(source, destination, workspace);
+            return outcomeOf(workspace.forward.settledCount() + workspace.backward.settledCount(), path);
+        }));
+    }
+
+    // Incremental tree repair: each query re-weights one out-edge of its source vertex in the adjacency list, and the
+    // repair work is reported as vertices settled. Runs last because it changes the adjacency list's weights.
+    {
+        using Tree = GraphAlgorithm::SSSP::DynamicDijkstra<VertexType, WeightType>;
+        start = std::chrono::steady_clock::now();
+        Tree tree(graphList, queries.front().first);
+        double treeMs = elapsedMs(start);
+        std::mt19937 weightGen(options.seed + 2);
+        std::uniform_int_distribution<WeightType> weightDist(1, options.maxWeight);
+        results.push_back(measure("dynamic-update", "adjacency-list", "4-ary-heap", numVertices, numEdges, treeMs, queries, [&](int source, int destination) {
+            auto neighbors = graphList.getNeighbors(source);
+            if (neighbors.empty()) {
+                return QueryOutcome{0, 0};
+            }
+            graphList.updateEdgeWeight(source, neighbors[destination % neighbors.size()].first, weightDist(weightGen));
+            return QueryOutcome{tree.lastUpdateWork(), 0};
+        }));
+        results.back().check = "n/a"; // Updates weights instead of answering the queries.
+    }
+
+    // Every row answers the same queries, so every compared row must find the reference row's distances.
+    int mismatches = 0;
+    for (Result& result : results) {
+        if (result.check == "n/a") {
+            continue;
+        }
+        result.check = result.distanceChecksum == results.front().distanceChecksum ? "ok" : "mismatch";
+        if (result.check == "mismatch") {
+            std::cerr << "Distance checksum of " << result.algorithm << "/" << result.backend << "/" << result.queue
+                      << " differs from " << results.front().algorithm << "/" << results.front().backend << "/" << results.front().queue
+                      << std::endl;
+            ++mismatches;
+        }
+    }
+
+    // Write the results.
+    std::ofstream file;
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath);
+        if (!file) {
+            std::cerr << "Cannot open " << options.outputPath << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = options.outputPath.empty() ? std::cout : file;
+    if (options.format == "json") {
+        writeJson(out, results);
+    } else {
+        writeCsv(out, results);
+    }
+    if (collectStats) {
+        std::ofstream statsFile(options.statsPath);
+        if (!statsFile) {
+            std::cerr << "Cannot open " << options.statsPath << std::endl;
+            return 1;
+        }
+        writeStats(statsFile, options.statsFormat, statsRows);
+    }
+    return mismatches > 0 ? 2 : 0;
+}
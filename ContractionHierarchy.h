@@ -0,0 +1,513 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include "Graph.h"
+#include "GraphAlgorithm.h"
+#include "IndexedDaryHeap.h"
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace GraphAlgorithm {
+    namespace SSSP {
+
+        // Class implementing Contraction Hierarchies (CH) for fast point-to-point queries on a static graph.
+        // Preprocessing contracts vertices one at a time in order of their edge difference (shortcuts needed minus edges
+        // removed, plus the number of already contracted neighbors to spread contraction evenly). Contracting v inserts a
+        // shortcut u -> x for every path u -> v -> x that a bounded witness search cannot beat without v. Every edge and
+        // shortcut is then stored with its lower-ranked endpoint: upward edges u -> x at u, and downward edges u -> x at x.
+        // A query runs Dijkstra upward from both endpoints and unpacks the shortcuts of the best meeting path.
+        // The preprocessed hierarchy can be saved and loaded so it need not be recomputed on every startup.
+        template <typename VertexType, typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type>
+        class ContractionHierarchy {
+        public:
+            // Search state for the two upward searches, reusable across queries.
+            struct Workspace {
+                DijkstraWorkspace<WeightType, QueueType> forward;  // Upward search from the source.
+                DijkstraWorkspace<WeightType, QueueType> backward; // Upward search from the destination over downward edges.
+            };
+
+            // Default cap on the vertices a single witness search may settle before giving up and keeping the shortcut.
+            static constexpr int DefaultWitnessSettleLimit = 500;
+
+            // Preprocesses a graph into a contraction hierarchy.
+            // Lower witness limits preprocess faster at the cost of some unnecessary shortcuts; queries stay exact either way.
+            explicit ContractionHierarchy(const Graph<VertexType, WeightType>& graph, int witnessSettleLimit = DefaultWitnessSettleLimit) {
+                contract(graph, witnessSettleLimit);
+            }
+
+            // Executes a point-to-point query and returns the shortest path in the same form as Dijkstra::execute.
+            ShortestPath<WeightType> execute(int source, int destination) const {
+                Workspace workspace;
+                return execute(source, destination, workspace);
+            }
+
+            // Executes a point-to-point query reusing the caller's workspace.
+            ShortestPath<WeightType> execute(int source, int destination, Workspace& workspace) const {
+                int numVertices = vertexCount();
+                if (source < 0 || source >= numVertices || destination < 0 || destination >= numVertices) {
+                    throw std::out_of_range("Vertex index out of range");
+                }
+                workspace.forward.beginQuery(numVertices);
+                workspace.backward.beginQuery(numVertices);
+                workspace.forward.update(source, 0, -1);
+                workspace.forward.frontier().push(source, 0);
+                workspace.backward.update(destination, 0, -1);
+                workspace.backward.frontier().push(destination, 0);
+
+                WeightType best = std::numeric_limits<WeightType>::max();
+                int meeting = -1;
+                if (source == destination) {
+                    best = 0;
+                    meeting = source;
+                }
+
+                // Alternate the two upward searches; each stops once it can no longer improve the best meeting path.
+                bool forwardDone = false;
+                bool backwardDone = false;
+                while (!forwardDone || !backwardDone) {
+                    if (!forwardDone) {
+                        forwardDone = !step(upward, workspace.forward, workspace.backward, best, meeting);
+                    }
+                    if (!backwardDone) {
+                        backwardDone = !step(downward, workspace.backward, workspace.forward, best, meeting);
+                    }
+                }
+
+                ShortestPath<WeightType> path;
+                if (meeting == -1) {
+                    return path; // No path, reported as unreachable just as Dijkstra::execute does.
+                }
+                path.reachable = true;
+                path.totalWeight = best;
+
+                // Collect the hierarchy path source -> meeting -> destination, then expand every shortcut on it.
+                std::vector<int> hierarchyPath;
+                workspace.forward.appendPath(meeting, hierarchyPath);
+                for (int at = workspace.backward.previous(meeting); at != -1; at = workspace.backward.previous(at)) {
+                    hierarchyPath.push_back(at);
+                }
+                path.vertices.push_back(hierarchyPath[0]);
+                for (std::size_t i = 1; i < hierarchyPath.size(); ++i) {
+                    unpack(hierarchyPath[i - 1], hierarchyPath[i], path);
+                }
+                return path;
+            }
+
+            // Returns the number of vertices in the hierarchy.
+            int vertexCount() const {
+                return static_cast<int>(rank.size());
+            }
+
+            // Returns the contraction rank of a vertex; higher-ranked vertices were contracted later.
+            int rankOf(int vertex) const {
+                return rank[vertex];
+            }
+
+            // Returns the number of shortcut edges the preprocessing inserted.
+            int shortcutCount() const {
+                int count = 0;
+                for (int middle : upward.middles) {
+                    count += middle != -1;
+                }
+                for (int middle : downward.middles) {
+                    count += middle != -1;
+                }
+                return count;
+            }
+
+            // Writes the preprocessed hierarchy to a binary stream.
+            void save(std::ostream& out) const {
+                static_assert(std::is_trivially_copyable<WeightType>::value, "Serialization requires a trivially copyable WeightType");
+                writeValue(out, FileMagic);
+                writeValue(out, static_cast<std::uint32_t>(sizeof(WeightType)));
+                writeVector(out, rank);
+                upward.save(out);
+                downward.save(out);
+                if (!out) {
+                    throw std::runtime_error("Failed to write contraction hierarchy");
+                }
+            }
+
+            // Reads a hierarchy previously written by save().
+            static ContractionHierarchy load(std::istream& in) {
+                static_assert(std::is_trivially_copyable<WeightType>::value, "Serialization requires a trivially copyable WeightType");
+                if (readValue<std::uint32_t>(in) != FileMagic) {
+                    throw std::runtime_error("Not a contraction hierarchy file");
+                }
+                if (readValue<std::uint32_t>(in) != sizeof(WeightType)) {
+                    throw std::runtime_error("Contraction hierarchy was saved with a different WeightType");
+                }
+                ContractionHierarchy hierarchy;
+                hierarchy.rank = readVector<int>(in);
+                checkFile(hierarchy.rank.size() <= static_cast<std::size_t>(std::numeric_limits<int>::max()));
+                // Queries index by rank, so the ranks must be a permutation of the vertex indices.
+                std::vector<char> seen(hierarchy.rank.size(), 0);
+                for (int r : hierarchy.rank) {
+                    checkFile(r >= 0 && r < hierarchy.vertexCount() && !seen[r]);
+                    seen[r] = 1;
+                }
+                hierarchy.upward.load(in, hierarchy.rank);
+                hierarchy.downward.load(in, hierarchy.rank);
+                return hierarchy;
+            }
+
+        private:
+            // Hierarchy edges in CSR form, grouped by their lower-ranked endpoint.
+            // middles holds the contracted vertex a shortcut bypasses, or -1 for an original edge.
+            struct EdgeSet {
+                std::vector<int> offsets;
+                std::vector<int> targets;
+                std::vector<WeightType> weights;
+                std::vector<int> middles;
+
+                void save(std::ostream& out) const {
+                    writeVector(out, offsets);
+                    writeVector(out, targets);
+                    writeVector(out, weights);
+                    writeVector(out, middles);
+                }
+
+                // Reads the edge set and checks everything queries rely on: monotonic offsets, targets ranked above the
+                // vertex storing the edge, and bypassed vertices ranked below it, so unpacking a shortcut terminates.
+                void load(std::istream& in, const std::vector<int>& rank) {
+                    offsets = readVector<int>(in);
+                    targets = readVector<int>(in);
+                    weights = readVector<WeightType>(in);
+                    middles = readVector<int>(in);
+                    int numVertices = static_cast<int>(rank.size());
+                    checkFile(offsets.size() == rank.size() + 1 && offsets[0] == 0 && offsets.back() == static_cast<int>(targets.size()) &&
+                              weights.size() == targets.size() && middles.size() == targets.size());
+                    for (int u = 0; u < numVertices; ++u) {
+                        checkFile(offsets[u] <= offsets[u + 1]);
+                        for (int i = offsets[u]; i < offsets[u + 1]; ++i) {
+                            int target = targets[i];
+                            int middle = middles[i];
+                            checkFile(target >= 0 && target < numVertices && rank[target] > rank[u]);
+                            checkFile(middle == -1 || (middle >= 0 && middle < numVertices && rank[middle] < rank[u]));
+                        }
+                    }
+                }
+            };
+
+            // Edge of the overlay graph used during contraction.
+            struct OverlayEdge {
+                int target;        // Other endpoint of the edge.
+                WeightType weight; // Edge weight.
+                int middle;        // Bypassed vertex for shortcuts, or -1.
+            };
+
+            // A shortcut found while contracting a vertex.
+            struct Shortcut {
+                int from;
+                int to;
+                WeightType weight;
+            };
+
+            static constexpr std::uint32_t FileMagic = 0x31484343; // "CCH1" in little-endian byte order.
+
+            std::vector<int> rank; // Contraction rank of every vertex.
+            EdgeSet upward;        // Edges u -> x with rank[x] > rank[u], stored at u.
+            EdgeSet downward;      // Edges x -> u with rank[x] > rank[u], stored at u with target x.
+
+            // Constructor used by load().
+            ContractionHierarchy() {}
+
+            // Contracts every vertex of the graph and builds the upward and downward edge sets.
+            void contract(const Graph<VertexType, WeightType>& graph, int witnessSettleLimit) {
+                int numVertices = graph.vertexCount();
+                // Overlay of the remaining (uncontracted) graph, with parallel edges merged and self-loops dropped.
+                std::vector<std::vector<OverlayEdge>> out(numVertices);
+                std::vector<std::vector<OverlayEdge>> in(numVertices);
+                for (int u = 0; u < numVertices; ++u) {
+                    for (const auto& edge : graph.getNeighbors(u)) {
+                        if (edge.first != u) {
+                            addOrImprove(out, in, u, edge.first, edge.second, -1);
+                        }
+                    }
+                }
+
+                DijkstraWorkspace<WeightType, QueueType> witness;
+                std::vector<Shortcut> shortcuts;
+                std::vector<int> contractedNeighbors(numVertices, 0);
+                std::vector<bool> contracted(numVertices, false);
+
+                // Priority of a vertex: edge difference plus contracted neighbors; lower is contracted first.
+                auto priorityOf = [&](int v) {
+                    shortcuts.clear();
+                    findShortcuts(out, in, v, witnessSettleLimit, witness, shortcuts);
+                    return static_cast<int>(shortcuts.size()) - static_cast<int>(out[v].size() + in[v].size()) + contractedNeighbors[v];
+                };
+
+                IndexedDaryHeap<int, 4> order(numVertices);
+                for (int v = 0; v < numVertices; ++v) {
+                    order.insert(v, priorityOf(v));
+                }
+
+                rank.assign(numVertices, 0);
+                std::vector<std::vector<OverlayEdge>> up(numVertices);
+                std::vector<std::vector<OverlayEdge>> down(numVertices);
+                int nextRank = 0;
+                while (!order.isEmpty()) {
+                    // Lazy updates: recompute the top vertex's priority and contract it only if it is still the smallest.
+                    int v = order.extractMin().second;
+                    int priority = priorityOf(v);
+                    if (!order.isEmpty() && order.peek().first < priority) {
+                        order.insert(v, priority);
+                        continue;
+                    }
+
+                    // priorityOf(v) left v's shortcuts in the buffer; insert them into the overlay.
+                    for (const Shortcut& shortcut : shortcuts) {
+                        addOrImprove(out, in, shortcut.from, shortcut.to, shortcut.weight, v);
+                    }
+
+                    // All remaining edges of v lead to higher-ranked vertices; record them and detach v from the overlay.
+                    rank[v] = nextRank++;
+                    contracted[v] = true;
+                    for (const OverlayEdge& edge : out[v]) {
+                        up[v].push_back(edge);
+                        removeEdge(in[edge.target], v);
+                        ++contractedNeighbors[edge.target];
+                    }
+                    for (const OverlayEdge& edge : in[v]) {
+                        down[v].push_back(edge);
+                        removeEdge(out[edge.target], v);
+                        ++contractedNeighbors[edge.target];
+                    }
+                    out[v].clear();
+                    in[v].clear();
+                }
+
+                freeze(up, upward);
+                freeze(down, downward);
+            }
+
+            // Collects the shortcuts contracting v would need, using bounded witness searches that avoid v.
+            static void findShortcuts(const std::vector<std::vector<OverlayEdge>>& out, const std::vector<std::vector<OverlayEdge>>& in,
+                                      int v, int witnessSettleLimit, DijkstraWorkspace<WeightType, QueueType>& witness,
+                                      std::vector<Shortcut>& shortcuts) {
+                if (out[v].empty()) {
+                    return;
+                }
+                for (const OverlayEdge& incoming : in[v]) {
+                    int u = incoming.target;
+                    // The witness search only needs to look as far as the longest path through v it might replace.
+                    WeightType limit = 0;
+                    for (const OverlayEdge& outgoing : out[v]) {
+                        if (outgoing.target != u && limit < incoming.weight + outgoing.weight) {
+                            limit = incoming.weight + outgoing.weight;
+                        }
+                    }
+
+                    // Dijkstra from u in the overlay without v, bounded by the limit and the settle budget.
+                    witness.beginQuery(static_cast<int>(out.size()));
+                    QueueType& queue = witness.frontier();
+                    witness.update(u, 0, -1);
+                    queue.push(u, 0);
+                    int settled = 0;
+                    while (!queue.isEmpty() && settled < witnessSettleLimit) {
+                        auto [distance, w] = queue.extractMin();
+                        if (witness.isSettled(w)) {
+                            continue;
+                        }
+                        if (limit < distance) {
+                            break;
+                        }
+                        witness.settle(w);
+                        ++settled;
+                        for (const OverlayEdge& edge : out[w]) {
+                            WeightType candidate = distance + edge.weight;
+                            if (edge.target != v && !witness.isSettled(edge.target) && candidate < witness.distance(edge.target)) {
+                                witness.update(edge.target, candidate, w);
+                                queue.push(edge.target, candidate);
+                            }
+                        }
+                    }
+
+                    // A path u -> v -> x needs a shortcut unless the witness search found one at least as short.
+                    for (const OverlayEdge& outgoing : out[v]) {
+                        int x = outgoing.target;
+                        WeightType via = incoming.weight + outgoing.weight;
+                        if (x != u && via < witness.distance(x)) {
+                            shortcuts.push_back({u, x, via});
+                        }
+                    }
+                }
+            }
+
+            // Adds the overlay edge from -> to, or lowers the weight of an existing one.
+            static void addOrImprove(std::vector<std::vector<OverlayEdge>>& out, std::vector<std::vector<OverlayEdge>>& in,
+                                     int from, int to, WeightType weight, int middle) {
+                for (OverlayEdge& edge : out[from]) {
+                    if (edge.target == to) {
+                        if (weight < edge.weight) {
+                            edge.weight = weight;
+                            edge.middle = middle;
+                            for (OverlayEdge& reverse : in[to]) {
+                                if (reverse.target == from) {
+                                    reverse.weight = weight;
+                                    reverse.middle = middle;
+                                    break;
+                                }
+                            }
+                        }
+                        return;
+                    }
+                }
+                out[from].push_back({to, weight, middle});
+                in[to].push_back({from, weight, middle});
+            }
+
+            // Removes the edge to a given target from an overlay edge list.
+            static void removeEdge(std::vector<OverlayEdge>& edges, int target) {
+                for (std::size_t i = 0; i < edges.size(); ++i) {
+                    if (edges[i].target == target) {
+                        edges[i] = edges.back();
+                        edges.pop_back();
+                        return;
+                    }
+                }
+            }
+
+            // Packs per-vertex edge lists into a CSR edge set.
+            static void freeze(const std::vector<std::vector<OverlayEdge>>& lists, EdgeSet& edges) {
+                edges.offsets.assign(1, 0);
+                for (const auto& list : lists) {
+                    for (const OverlayEdge& edge : list) {
+                        edges.targets.push_back(edge.target);
+                        edges.weights.push_back(edge.weight);
+                        edges.middles.push_back(edge.middle);
+                    }
+                    edges.offsets.push_back(static_cast<int>(edges.targets.size()));
+                }
+            }
+
+            // Settles one vertex of an upward search and relaxes its hierarchy edges.
+            // Returns false once the search is exhausted or cannot improve on the best meeting path.
+            static bool step(const EdgeSet& edges, DijkstraWorkspace<WeightType, QueueType>& self,
+                             const DijkstraWorkspace<WeightType, QueueType>& other, WeightType& best, int& meeting) {
+                QueueType& queue = self.frontier();
+                while (!queue.isEmpty()) {
+                    auto [distance, u] = queue.extractMin();
+                    // Skip stale entries left behind by lazy queues.
+                    if (self.isSettled(u)) {
+                        continue;
+                    }
+                    if (!(distance < best)) {
+                        return false;
+                    }
+                    self.settle(u);
+                    WeightType remaining = other.distance(u);
+                    if (remaining != std::numeric_limits<WeightType>::max() && distance + remaining < best) {
+                        best = distance + remaining;
+                        meeting = u;
+                    }
+                    for (int i = edges.offsets[u]; i < edges.offsets[u + 1]; ++i) {
+                        int v = edges.targets[i];
+                        WeightType candidate = distance + edges.weights[i];
+                        if (!self.isSettled(v) && candidate < self.distance(v)) {
+                            self.update(v, candidate, u);
+                            queue.push(v, candidate);
+                        }
+                    }
+                    return true;
+                }
+                return false;
+            }
+
+            // Returns the bypassed vertex of the hierarchy edge from -> to, or -1 if it is an original edge.
+            int middleOf(int from, int to) const {
+                if (rank[from] < rank[to]) {
+                    for (int i = upward.offsets[from]; i < upward.offsets[from + 1]; ++i) {
+                        if (upward.targets[i] == to) {
+                            return upward.middles[i];
+                        }
+                    }
+                } else {
+                    for (int i = downward.offsets[to]; i < downward.offsets[to + 1]; ++i) {
+                        if (downward.targets[i] == from) {
+                            return downward.middles[i];
+                        }
+                    }
+                }
+                throw std::logic_error("Hierarchy edge does not exist");
+            }
+
+            // Appends the original vertices of the hierarchy edge from -> to (excluding from) to the path.
+            // Shortcuts are expanded with an explicit stack, so deep hierarchies cannot overflow the call stack.
+            void unpack(int from, int to, ShortestPath<WeightType>& path) const {
+                std::vector<std::pair<int, int>> pending{{from, to}};
+                while (!pending.empty()) {
+                    auto [a, b] = pending.back();
+                    pending.pop_back();
+                    int middle = middleOf(a, b);
+                    if (middle == -1) {
+                        path.vertices.push_back(b);
+                    } else {
+                        // Expand a -> middle before middle -> b.
+                        pending.push_back({middle, b});
+                        pending.push_back({a, middle});
+                    }
+                }
+            }
+
+            // Binary serialization helpers.
+            template <typename T>
+            static void writeValue(std::ostream& out, const T& value) {
+                out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            template <typename T>
+            static T readValue(std::istream& in) {
+                T value;
+                if (!in.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+                    throw std::runtime_error("Unexpected end of contraction hierarchy file");
+                }
+                return value;
+            }
+
+            template <typename T>
+            static void writeVector(std::ostream& out, const std::vector<T>& values) {
+                writeValue(out, static_cast<std::uint64_t>(values.size()));
+                out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+            }
+
+            // Reads a vector in chunks, so a corrupt element count cannot allocate more than the stream actually holds.
+            template <typename T>
+            static std::vector<T> readVector(std::istream& in) {
+                static constexpr std::size_t ChunkElements = (std::size_t(1) << 20) / sizeof(T) + 1;
+                std::uint64_t size = readValue<std::uint64_t>(in);
+                std::vector<T> values;
+                while (values.size() < size) {
+                    std::size_t done = values.size();
+                    std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(ChunkElements, size - done));
+                    values.resize(done + chunk);
+                    if (!in.read(reinterpret_cast<char*>(values.data() + done), chunk * sizeof(T))) {
+                        throw std::runtime_error("Unexpected end of contraction hierarchy file");
+                    }
+                }
+                return values;
+            }
+
+            // Throws the corrupt-file error unless a check on loaded data holds.
+            static void checkFile(bool valid) {
+                if (!valid) {
+                    throw std::runtime_error("Corrupt contraction hierarchy file");
+                }
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // CONTRACTIONHIERARCHY_H
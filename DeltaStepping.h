@@ -0,0 +1,219 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef DELTASTEPPING_H
+#define DELTASTEPPING_H
+
+#include "GraphAlgorithm.h"
+#include "Parallel.h"
+#include <vector>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace GraphAlgorithm {
+    namespace SSSP {
+
+        // Class implementing parallel delta-stepping for full single-source shortest-path trees.
+        // Vertices are kept in buckets of width delta by tentative distance. The lowest non-empty bucket is emptied in phases
+        // that relax the light edges (weight <= delta) of all its vertices at once, since those may refill the same bucket;
+        // once it stays empty, the heavy edges of every vertex it held are relaxed in one more phase. Within a phase, threads
+        // scan disjoint slices of the frontier and only read distances, writing candidate updates into per-thread request
+        // buffers; the requests are then applied in a single pass. The threads form a WorkerTeam that lives for the whole
+        // execute call, so graphs with many buckets do not pay for starting threads in every phase. The result has exactly
+        // the distances sequential Dijkstra computes; predecessors may differ between equally short paths.
+        template <typename VertexType, typename WeightType>
+        class DeltaStepping {
+        public:
+            // Smallest frontier slice worth handing to an extra thread; smaller phases run on the calling thread.
+            static constexpr int MinVerticesPerThread = 256;
+
+            // Computes the distance and predecessor of every vertex from the source.
+            // A delta of zero picks the maximum edge weight divided by the average out-degree. Small deltas approach
+            // Dijkstra (little parallelism, no wasted work); large deltas approach Bellman-Ford (more parallelism and
+            // re-relaxations). numThreads of zero uses one thread per hardware thread.
+            template <typename GraphType>
+            static ShortestPathTree<WeightType> execute(const GraphType& graph, int source, WeightType delta = 0, int numThreads = 0) {
+                int numVertices = graph.vertexCount();
+                if (source < 0 || source >= numVertices) {
+                    throw std::out_of_range("Vertex index out of range");
+                }
+                numThreads = resolveThreadCount(numThreads);
+
+                // The maximum edge weight bounds how many buckets are usually live at once; a bucket rounded past that span
+                // shares its slot with a lower one and waits there until its own turn.
+                WeightType maxWeight = 0;
+                long long numEdges = 0;
+                for (int u = 0; u < numVertices; ++u) {
+                    for (const auto& edge : neighborsOf(graph, u)) {
+                        if (edge.second < 0) {
+                            throw std::invalid_argument("Delta-stepping requires non-negative edge weights");
+                        }
+                        maxWeight = std::max(maxWeight, edge.second);
+                        ++numEdges;
+                    }
+                }
+                if (!(delta > 0)) {
+                    double averageDegree = std::max(1.0, static_cast<double>(numEdges) / numVertices);
+                    delta = static_cast<WeightType>(maxWeight / averageDegree);
+                    if (!(delta > 0)) {
+                        delta = maxWeight > 0 ? maxWeight : 1;
+                    }
+                }
+
+                State state(numVertices, delta, static_cast<long long>(maxWeight / delta) + 2, numThreads);
+                WorkerTeam team(numThreads);
+                state.relax(source, 0, -1);
+
+                std::vector<int> frontier;   // Vertices removed from the current bucket in this phase.
+                std::vector<int> settled;    // Every vertex removed from the current bucket; its heavy edges are relaxed last.
+                std::vector<long long> inSettled(numVertices, -1); // Bucket in which a vertex was last added to settled.
+                long long current = 0;
+                while (state.nextBucket(current)) {
+                    settled.clear();
+                    // Light phases: repeat until relaxing light edges stops refilling the current bucket.
+                    while (state.takeBucket(current, frontier)) {
+                        for (int v : frontier) {
+                            if (inSettled[v] != current) {
+                                inSettled[v] = current;
+                                settled.push_back(v);
+                            }
+                        }
+                        relaxPhase(graph, frontier, true, state, team);
+                    }
+                    // Heavy phase: these edges always lead past the current bucket.
+                    relaxPhase(graph, settled, false, state, team);
+                }
+
+                ShortestPathTree<WeightType> tree;
+                tree.distances = std::move(state.distances);
+                tree.previous = std::move(state.previous);
+                return tree;
+            }
+
+        private:
+            // Candidate distance for a vertex produced during a relaxation phase.
+            struct Request {
+                int vertex;
+                WeightType distance;
+                int previous;
+            };
+
+            // Distances, predecessors and the circular bucket array of one run.
+            struct State {
+                std::vector<WeightType> distances;          // Tentative distance of every vertex.
+                std::vector<int> previous;                  // Tentative predecessor of every vertex.
+                std::vector<std::vector<int>> buckets;      // Circular array; bucket i lives in slot i % buckets.size().
+                std::vector<long long> bucketOf;            // Bucket holding a vertex's live entry, or -1; older entries are stale.
+                std::vector<std::vector<Request>> requests; // Per-thread request buffers, reused across phases.
+                WeightType delta;                           // Bucket width.
+
+                State(int numVertices, WeightType delta, long long numBuckets, int numThreads)
+                    : distances(numVertices, std::numeric_limits<WeightType>::max()), previous(numVertices, -1),
+                      buckets(numBuckets), bucketOf(numVertices, -1), requests(numThreads), delta(delta) {}
+
+                // Lowers a vertex's tentative distance and moves it to the matching bucket.
+                void relax(int vertex, WeightType distance, int predecessor) {
+                    if (distance < distances[vertex]) {
+                        distances[vertex] = distance;
+                        previous[vertex] = predecessor;
+                        long long bucket = static_cast<long long>(distance / delta);
+                        buckets[bucket % buckets.size()].push_back(vertex);
+                        bucketOf[vertex] = bucket; // Any older entry of the vertex is now stale.
+                    }
+                }
+
+                // Checks whether a vertex has a live entry in the given slot, for whichever bucket.
+                bool liveIn(int vertex, std::size_t slot) const {
+                    return bucketOf[vertex] >= 0 && static_cast<std::size_t>(bucketOf[vertex]) % buckets.size() == slot;
+                }
+
+                // Advances current to the lowest bucket holding a live entry; returns false when every bucket is empty.
+                bool nextBucket(long long& current) {
+                    long long lowest = -1; // Lowest bucket seen in a slot it shares with a lower bucket.
+                    for (std::size_t k = 0; k < buckets.size(); ++k) {
+                        long long bucket = current + static_cast<long long>(k);
+                        std::size_t index = bucket % buckets.size();
+                        std::vector<int>& slot = buckets[index];
+                        // Drop stale entries so an all-stale bucket counts as empty.
+                        slot.erase(std::remove_if(slot.begin(), slot.end(), [this, index](int v) { return !liveIn(v, index); }), slot.end());
+                        for (int v : slot) {
+                            if (bucketOf[v] == bucket) {
+                                current = bucket;
+                                return true;
+                            }
+                            lowest = lowest == -1 ? bucketOf[v] : std::min(lowest, bucketOf[v]);
+                        }
+                    }
+                    // Only buckets a full lap or more ahead are left.
+                    current = lowest;
+                    return lowest != -1;
+                }
+
+                // Moves the live, distinct vertices of a bucket into frontier; returns false if there were none.
+                // Entries of a later bucket that shares the slot stay in it.
+                bool takeBucket(long long bucket, std::vector<int>& frontier) {
+                    frontier.clear();
+                    std::size_t index = bucket % buckets.size();
+                    std::vector<int>& slot = buckets[index];
+                    std::size_t kept = 0;
+                    for (std::size_t i = 0; i < slot.size(); ++i) {
+                        int v = slot[i];
+                        if (bucketOf[v] == bucket) {
+                            bucketOf[v] = -1; // Also marks later duplicates in this slot as stale.
+                            frontier.push_back(v);
+                        } else if (liveIn(v, index)) {
+                            slot[kept++] = v;
+                        }
+                    }
+                    slot.resize(kept);
+                    return !frontier.empty();
+                }
+            };
+
+            // Relaxes the light or heavy edges of every vertex in the frontier.
+            // The team's threads fill their own request buffers from disjoint slices of the frontier; the buffers are applied afterwards.
+            template <typename GraphType>
+            static void relaxPhase(const GraphType& graph, const std::vector<int>& frontier, bool light, State& state, WorkerTeam& team) {
+                int count = static_cast<int>(frontier.size());
+                if (count == 0) {
+                    return;
+                }
+                int numThreads = std::min(static_cast<int>(state.requests.size()), std::max(1, count / MinVerticesPerThread));
+                int chunk = (count + numThreads - 1) / numThreads;
+
+                auto scan = [&graph, &frontier, &state, light, count, chunk](int thread) {
+                    std::vector<Request>& buffer = state.requests[thread];
+                    buffer.clear();
+                    int last = std::min(count, (thread + 1) * chunk);
+                    for (int i = thread * chunk; i < last; ++i) {
+                        int u = frontier[i];
+                        WeightType distance = state.distances[u];
+                        for (const auto& edge : neighborsOf(graph, u)) {
+                            if ((edge.second <= state.delta) != light) {
+                                continue;
+                            }
+                            WeightType candidate = distance + edge.second;
+                            if (candidate < state.distances[edge.first]) {
+                                buffer.push_back({edge.first, candidate, u});
+                            }
+                        }
+                    }
+                };
+
+                team.run(numThreads, scan);
+
+                // Apply the requests in thread order; relax() keeps only improvements.
+                for (int thread = 0; thread < numThreads; ++thread) {
+                    for (const Request& request : state.requests[thread]) {
+                        state.relax(request.vertex, request.distance, request.previous);
+                    }
+                }
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // DELTASTEPPING_H
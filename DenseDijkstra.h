@@ -0,0 +1,333 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef DENSEDIJKSTRA_H
+#define DENSEDIJKSTRA_H
+
+#include "GraphAlgorithm.h"
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace GraphAlgorithm {
+    // Trait detecting graph types that expose each adjacency-matrix row as a contiguous array, such as GraphAdjacencyMatrix.
+    template <typename GraphType, typename = void>
+    struct HasDenseRows : std::false_type {};
+
+    template <typename GraphType>
+    struct HasDenseRows<GraphType, std::void_t<decltype(std::declval<const GraphType&>().row(0)),
+                                               decltype(std::declval<const GraphType&>().noEdge())>> : std::true_type {};
+
+    // Trait detecting graph types that report their edge count in constant time, such as GraphCSR.
+    template <typename GraphType, typename = void>
+    struct HasEdgeCount : std::false_type {};
+
+    template <typename GraphType>
+    struct HasEdgeCount<GraphType, std::void_t<decltype(std::declval<const GraphType&>().edgeCount())>> : std::true_type {};
+
+    namespace SSSP {
+
+        // Class implementing the classic O(V^2) array-scan variant of Dijkstra's algorithm for dense graphs.
+        // Instead of a priority queue, every step scans a key array holding the tentative distance of each unsettled vertex
+        // (settled vertices hold the maximum WeightType) for its minimum, then relaxes all edges of that vertex. Nothing is
+        // ever queued, so the O(E) lazy heap growth of dense graphs disappears. On graphs exposing matrix rows (HasDenseRows),
+        // a whole row is relaxed at once against the distance array. With AVX2, both the minimum scan and the row relaxation
+        // process a vector of float, double, int32 or int64 weights per instruction; other builds and types use scalar loops.
+        // Dijkstra::execute and Dijkstra::shortestPathTree switch to this class on their own whenever isPreferred() holds.
+        template <typename VertexType, typename WeightType>
+        class DenseDijkstra {
+        private:
+            // Number of padding cells appended to the arrays so vector loops never need a scalar tail.
+            static constexpr int Padding = 16;
+            // Number of weights in one 32-byte vector.
+            static constexpr int VectorCells = sizeof(WeightType) < 32 ? static_cast<int>(32 / sizeof(WeightType)) : 1;
+
+        public:
+            // Per-search arrays, padded with unreachable entries to a multiple of Padding.
+            // Callers can keep one per thread to reuse its buffers; each query still refills them in O(V), which the
+            // O(V^2) search dwarfs.
+            class Workspace {
+            public:
+                std::vector<WeightType> distances; // Tentative distance of every vertex.
+                std::vector<WeightType> keys;      // Tentative distance of unsettled vertices; the maximum WeightType once settled.
+                std::vector<int> previous;         // Predecessor on the tentative shortest path, or -1.
+                int numVertices = 0;               // Vertices in the graph of the current query.
+                int numSettled = 0;                // Vertices settled in the current query.
+
+                // Starts a new query over a graph with the given number of vertices.
+                void beginQuery(int vertices) {
+                    std::size_t size = (static_cast<std::size_t>(vertices) + Padding - 1) / Padding * Padding;
+                    distances.assign(size, std::numeric_limits<WeightType>::max());
+                    keys.assign(size, std::numeric_limits<WeightType>::max());
+                    previous.assign(size, -1);
+                    numVertices = vertices;
+                    numSettled = 0;
+                }
+
+                // Returns the number of vertices settled in the current query.
+                int settledCount() const {
+                    return numSettled;
+                }
+            };
+
+            // Edge density (edges / vertices^2) from which graphs with matrix rows are searched densely. Below it, a
+            // heap search over the matrix's occupancy-skipping neighbor scans settles far fewer vertices per second.
+            static constexpr double MatrixDensityThreshold = 0.03;
+            // Edge density from which graphs without matrix rows, whose edges are relaxed one at a time, are searched densely.
+            static constexpr double DensityThreshold = 0.05;
+
+            // Checks whether the dense search should be used on a graph whose edge count is known in constant time.
+            // Graphs without edgeCount() (such as GraphAdjacencyList) always use the heap search.
+            template <typename GraphType>
+            static bool isPreferred(const GraphType& graph) {
+                if constexpr (HasEdgeCount<GraphType>::value) {
+                    double numVertices = graph.vertexCount();
+                    double threshold = HasDenseRows<GraphType>::value ? MatrixDensityThreshold : DensityThreshold;
+                    return numVertices > 0 && static_cast<double>(graph.edgeCount()) >= threshold * numVertices * numVertices;
+                } else {
+                    return false;
+                }
+            }
+
+            // Executes the dense search from a source vertex to a destination vertex.
+            // Returns the shortest path in the same form as Dijkstra::execute.
+            template <typename GraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination) {
+                Workspace workspace;
+                return execute(graph, source, destination, workspace);
+            }
+
+            // Executes the dense search reusing the caller's workspace.
+            template <typename GraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination, Workspace& state) {
+                search(graph, source, destination, state);
+                ShortestPath<WeightType> path;
+                if (state.distances[destination] != std::numeric_limits<WeightType>::max()) {
+                    path.reachable = true;
+                    path.totalWeight = state.distances[destination];
+                    int length = 0;
+                    for (int at = destination; at != -1; at = state.previous[at]) {
+                        ++length;
+                    }
+                    path.vertices.resize(length);
+                    for (int at = destination; at != -1; at = state.previous[at]) {
+                        path.vertices[--length] = at; // Filled back-to-front, so no reversal is needed.
+                    }
+                }
+                return path;
+            }
+
+            // Computes the full shortest-path tree from a source, in the same form as Dijkstra::shortestPathTree.
+            template <typename GraphType>
+            static ShortestPathTree<WeightType> shortestPathTree(const GraphType& graph, int source) {
+                int numVertices = graph.vertexCount();
+                Workspace state;
+                search(graph, source, -1, state);
+                ShortestPathTree<WeightType> tree;
+                state.distances.resize(numVertices); // Drop the padding.
+                state.previous.resize(numVertices);
+                tree.distances = std::move(state.distances);
+                tree.previous = std::move(state.previous);
+                return tree;
+            }
+
+        private:
+            // Runs the array-scan search, stopping once the destination is settled; a destination of -1 settles everything.
+            template <typename GraphType>
+            static void search(const GraphType& graph, int source, int destination, Workspace& state) {
+                int numVertices = graph.vertexCount();
+                if (source < 0 || source >= numVertices || destination < -1 || destination >= numVertices) {
+                    throw std::out_of_range("Vertex index out of range");
+                }
+                state.beginQuery(numVertices);
+                state.distances[source] = 0;
+                state.keys[source] = 0;
+                while (true) {
+                    int u = argMin(state.keys.data(), static_cast<int>(state.keys.size()));
+                    if (u == -1) {
+                        break; // Every remaining vertex is unreachable.
+                    }
+                    state.keys[u] = std::numeric_limits<WeightType>::max(); // Settle u.
+                    ++state.numSettled;
+                    if (u == destination) {
+                        break;
+                    }
+                    WeightType distance = state.distances[u];
+                    if constexpr (HasDenseRows<GraphType>::value) {
+                        relaxRow(graph.row(u), graph.noEdge(), distance, u, state);
+                    } else {
+                        for (const auto& neighbor : neighborsOf(graph, u)) {
+                            WeightType candidate = distance + neighbor.second;
+                            if (candidate < state.distances[neighbor.first]) {
+                                state.distances[neighbor.first] = candidate;
+                                state.keys[neighbor.first] = candidate;
+                                state.previous[neighbor.first] = u;
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Returns the index of the smallest key, or -1 if every key is the maximum WeightType.
+            // count is a multiple of Padding. The minimum is reduced first, then located with an early-exit equality scan.
+            static int argMin(const WeightType* keys, int count) {
+                WeightType best = std::numeric_limits<WeightType>::max();
+#if defined(__AVX2__)
+                if constexpr (std::is_same<WeightType, double>::value) {
+                    __m256d low = _mm256_set1_pd(best);
+                    for (int i = 0; i < count; i += 4) {
+                        low = _mm256_min_pd(low, _mm256_loadu_pd(keys + i));
+                    }
+                    alignas(32) double lanes[4];
+                    _mm256_store_pd(lanes, low);
+                    best = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+                } else if constexpr (std::is_same<WeightType, float>::value) {
+                    __m256 low = _mm256_set1_ps(best);
+                    for (int i = 0; i < count; i += 8) {
+                        low = _mm256_min_ps(low, _mm256_loadu_ps(keys + i));
+                    }
+                    alignas(32) float lanes[8];
+                    _mm256_store_ps(lanes, low);
+                    best = *std::min_element(lanes, lanes + 8);
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 4) {
+                    __m256i low = _mm256_set1_epi32(best);
+                    for (int i = 0; i < count; i += 8) {
+                        low = _mm256_min_epi32(low, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)));
+                    }
+                    alignas(32) std::int32_t lanes[8];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), low);
+                    best = *std::min_element(lanes, lanes + 8);
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 8) {
+                    __m256i low = _mm256_set1_epi64x(best);
+                    for (int i = 0; i < count; i += 4) {
+                        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+                        low = _mm256_blendv_epi8(low, value, _mm256_cmpgt_epi64(low, value)); // No 64-bit min before AVX-512.
+                    }
+                    alignas(32) std::int64_t lanes[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), low);
+                    best = *std::min_element(lanes, lanes + 4);
+                } else
+#endif
+                {
+                    for (int i = 0; i < count; ++i) {
+                        best = keys[i] < best ? keys[i] : best;
+                    }
+                }
+                if (best == std::numeric_limits<WeightType>::max()) {
+                    return -1;
+                }
+                for (int i = 0; i < count; ++i) {
+                    if (keys[i] == best) {
+                        return i;
+                    }
+                }
+                return -1;
+            }
+
+            // Relaxes every edge of u given its matrix row, which holds noEdge for missing edges and is padded with noEdge.
+            // Settled vertices are never lowered: with non-negative weights their distance is already at most distance(u).
+            static void relaxRow(const WeightType* row, WeightType noEdge, WeightType distance, int u, Workspace& state) {
+                WeightType* distances = state.distances.data();
+                WeightType* keys = state.keys.data();
+#if defined(__AVX2__)
+                // Vector loops cover whole vectors only; the row's own padding keeps the last one in bounds.
+                int count = (state.numVertices + VectorCells - 1) / VectorCells * VectorCells;
+                if constexpr (std::is_same<WeightType, double>::value) {
+                    __m256d base = _mm256_set1_pd(distance);
+                    __m256d none = _mm256_set1_pd(noEdge);
+                    for (int i = 0; i < count; i += 4) {
+                        __m256d weights = _mm256_loadu_pd(row + i);
+                        __m256d candidates = _mm256_add_pd(base, weights);
+                        __m256d current = _mm256_loadu_pd(distances + i);
+                        __m256d better = _mm256_and_pd(_mm256_cmp_pd(weights, none, _CMP_NEQ_UQ), _mm256_cmp_pd(candidates, current, _CMP_LT_OQ));
+                        int mask = _mm256_movemask_pd(better);
+                        if (mask != 0) {
+                            _mm256_storeu_pd(distances + i, _mm256_blendv_pd(current, candidates, better));
+                            _mm256_storeu_pd(keys + i, _mm256_blendv_pd(_mm256_loadu_pd(keys + i), candidates, better));
+                            setPrevious(state, i, mask, u);
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_same<WeightType, float>::value) {
+                    __m256 base = _mm256_set1_ps(distance);
+                    __m256 none = _mm256_set1_ps(noEdge);
+                    for (int i = 0; i < count; i += 8) {
+                        __m256 weights = _mm256_loadu_ps(row + i);
+                        __m256 candidates = _mm256_add_ps(base, weights);
+                        __m256 current = _mm256_loadu_ps(distances + i);
+                        __m256 better = _mm256_and_ps(_mm256_cmp_ps(weights, none, _CMP_NEQ_UQ), _mm256_cmp_ps(candidates, current, _CMP_LT_OQ));
+                        int mask = _mm256_movemask_ps(better);
+                        if (mask != 0) {
+                            _mm256_storeu_ps(distances + i, _mm256_blendv_ps(current, candidates, better));
+                            _mm256_storeu_ps(keys + i, _mm256_blendv_ps(_mm256_loadu_ps(keys + i), candidates, better));
+                            setPrevious(state, i, mask, u);
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 4) {
+                    __m256i base = _mm256_set1_epi32(distance);
+                    __m256i none = _mm256_set1_epi32(noEdge);
+                    for (int i = 0; i < count; i += 8) {
+                        __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+                        __m256i candidates = _mm256_add_epi32(base, weights); // Wraps for missing edges, which are masked out.
+                        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distances + i));
+                        __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi32(weights, none), _mm256_cmpgt_epi32(current, candidates));
+                        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(better));
+                        if (mask != 0) {
+                            __m256i* keyVector = reinterpret_cast<__m256i*>(keys + i);
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i), _mm256_blendv_epi8(current, candidates, better));
+                            _mm256_storeu_si256(keyVector, _mm256_blendv_epi8(_mm256_loadu_si256(keyVector), candidates, better));
+                            setPrevious(state, i, mask, u);
+                        }
+                    }
+                    return;
+                } else if constexpr (std::is_integral<WeightType>::value && std::is_signed<WeightType>::value && sizeof(WeightType) == 8) {
+                    __m256i base = _mm256_set1_epi64x(distance);
+                    __m256i none = _mm256_set1_epi64x(noEdge);
+                    for (int i = 0; i < count; i += 4) {
+                        __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+                        __m256i candidates = _mm256_add_epi64(base, weights);
+                        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(distances + i));
+                        __m256i better = _mm256_andnot_si256(_mm256_cmpeq_epi64(weights, none), _mm256_cmpgt_epi64(current, candidates));
+                        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(better));
+                        if (mask != 0) {
+                            __m256i* keyVector = reinterpret_cast<__m256i*>(keys + i);
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(distances + i), _mm256_blendv_epi8(current, candidates, better));
+                            _mm256_storeu_si256(keyVector, _mm256_blendv_epi8(_mm256_loadu_si256(keyVector), candidates, better));
+                            setPrevious(state, i, mask, u);
+                        }
+                    }
+                    return;
+                }
+#endif
+                for (int i = 0; i < state.numVertices; ++i) {
+                    if (row[i] != noEdge) {
+                        WeightType candidate = distance + row[i];
+                        if (candidate < distances[i]) {
+                            distances[i] = candidate;
+                            keys[i] = candidate;
+                            state.previous[i] = u;
+                        }
+                    }
+                }
+            }
+
+            // Records u as the predecessor of every lane set in a relaxation mask starting at index first.
+            static void setPrevious(Workspace& state, int first, int mask, int u) {
+                for (int lane = 0; mask != 0; ++lane, mask >>= 1) {
+                    if (mask & 1) {
+                        state.previous[first + lane] = u;
+                    }
+                }
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // DENSEDIJKSTRA_H
@@ -0,0 +1,150 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef DIALBUCKETQUEUE_H
+#define DIALBUCKETQUEUE_H
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+// A template class DialBucketQueue implementing Dial's monotone bucket queue for integral keys.
+// Keys live in a circular array of buckets, one bucket per key value, covering the window [cursor, cursor + numBuckets).
+// Dijkstra's keys never exceed the last extracted key plus the largest edge weight, so the window only needs to be
+// as wide as the maximum weight; it doubles automatically if a wider key is pushed.
+// Each id is stored at most once, and decreaseKey moves it between buckets in O(1).
+template <typename Key>
+class DialBucketQueue {
+    static_assert(std::is_integral<Key>::value, "DialBucketQueue requires an integral key type");
+
+private:
+    std::vector<std::vector<int>> buckets; // Circular array of buckets; bucket (key & mask) holds ids with that key.
+    std::vector<Key> keys;                 // Current key of each queued id.
+    std::vector<int> slot;                 // Index of each id within its bucket, or -1 if the id is not queued.
+    Key cursor;                            // Smallest key that can still be in the queue (the last extracted key).
+    int count;                             // Number of queued ids.
+
+    // Returns the bucket index of a key.
+    std::size_t bucketOf(Key key) const {
+        return static_cast<std::size_t>(key) & (buckets.size() - 1);
+    }
+
+    // Removes an id from its bucket by moving the bucket's last id into its slot.
+    void unlink(int id) {
+        std::vector<int>& bucket = buckets[bucketOf(keys[id])];
+        int moved = bucket.back();
+        bucket[slot[id]] = moved;
+        slot[moved] = slot[id];
+        bucket.pop_back();
+        slot[id] = -1;
+    }
+
+    // Appends an id to the bucket of its current key.
+    void link(int id) {
+        std::vector<int>& bucket = buckets[bucketOf(keys[id])];
+        slot[id] = static_cast<int>(bucket.size());
+        bucket.push_back(id);
+    }
+
+    // Doubles the number of buckets until the window can hold the given key, redistributing queued ids.
+    void grow(Key key) {
+        std::size_t numBuckets = buckets.size();
+        while (static_cast<std::size_t>(key - cursor) >= numBuckets) {
+            numBuckets *= 2;
+        }
+        std::vector<std::vector<int>> old(numBuckets);
+        old.swap(buckets);
+        for (auto& bucket : old) {
+            for (int id : bucket) {
+                link(id);
+            }
+        }
+    }
+
+public:
+    // Constructor initializes an empty queue whose window fits keys up to maxWeight past the cursor without growing.
+    explicit DialBucketQueue(Key maxWeight = 0) : cursor(0), count(0) {
+        std::size_t numBuckets = 64;
+        while (numBuckets <= static_cast<std::size_t>(maxWeight)) {
+            numBuckets *= 2;
+        }
+        buckets.resize(numBuckets);
+    }
+
+    // Empties the queue and makes room for ids in [0, capacity).
+    // Only the buckets between the cursor and the remaining ids are touched.
+    void reset(int capacity) {
+        for (std::size_t i = 0; count > 0; ++i) {
+            std::vector<int>& bucket = buckets[bucketOf(static_cast<Key>(cursor + i))];
+            for (int id : bucket) {
+                slot[id] = -1;
+            }
+            count -= static_cast<int>(bucket.size());
+            bucket.clear();
+        }
+        cursor = 0;
+        if (static_cast<int>(slot.size()) < capacity) {
+            slot.resize(capacity, -1);
+            keys.resize(capacity);
+        }
+    }
+
+    // Checks if an id is currently queued.
+    bool contains(int id) const {
+        return id >= 0 && id < static_cast<int>(slot.size()) && slot[id] != -1;
+    }
+
+    // Inserts the id, or lowers its key if it is already queued.
+    // Keys must not be smaller than the last extracted key.
+    void push(int id, Key key) {
+        if (id < 0 || id >= static_cast<int>(slot.size())) {
+            throw std::out_of_range("Queue id out of range");
+        }
+        if (key < cursor) {
+            throw std::invalid_argument("Key is smaller than the last extracted key");
+        }
+        if (slot[id] != -1) {
+            if (!(key < keys[id])) {
+                return; // Not an improvement; keep the current key.
+            }
+            unlink(id);
+            --count;
+        }
+        if (static_cast<std::size_t>(key - cursor) >= buckets.size()) {
+            grow(key);
+        }
+        keys[id] = key;
+        link(id);
+        ++count;
+    }
+
+    // Extracts the id with the minimum key as a (key, id) pair.
+    std::pair<Key, int> extractMin() {
+        if (count == 0) {
+            throw std::range_error("Queue is empty"); // Safety check.
+        }
+        // Advance the cursor to the first non-empty bucket; every key in the window maps to a distinct bucket.
+        while (buckets[bucketOf(cursor)].empty()) {
+            ++cursor;
+        }
+        std::vector<int>& bucket = buckets[bucketOf(cursor)];
+        int id = bucket.back();
+        bucket.pop_back();
+        slot[id] = -1;
+        --count;
+        return {cursor, id};
+    }
+
+    // Checks if the queue is empty.
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    // Returns the number of queued ids.
+    int size() const {
+        return count;
+    }
+};
+
+#endif // DIALBUCKETQUEUE_H
@@ -0,0 +1,356 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef DYNAMICDIJKSTRA_H
+#define DYNAMICDIJKSTRA_H
+
+#include "GraphAlgorithm.h"
+#include "GraphAdjacencyList.h"
+#include "GraphObserver.h"
+#include "IndexedDaryHeap.h"
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace GraphAlgorithm {
+    namespace SSSP {
+
+        // Class maintaining the shortest-path tree of one source while its GraphAdjacencyList changes.
+        // It subscribes to the graph and repairs the tree after every addEdge, removeEdge and updateEdgeWeight in the
+        // manner of Ramalingam and Reps:
+        //   - An edge that gets cheaper or is added can only shorten paths. If it improves its head, a Dijkstra search
+        //     seeded at the head spreads the improvement and stops wherever distances no longer drop.
+        //   - An edge that gets dearer or is removed can only lengthen paths, and only if it is the tree edge into its head.
+        //     The head's subtree is then checked in order of old distance; a vertex keeps its distance if some unaffected
+        //     in-neighbour still offers it, and is re-parented there. The remaining, affected vertices are seeded with their
+        //     best distance through unaffected in-neighbours and settled by a Dijkstra search restricted to them.
+        // Either way the work is proportional to the vertices whose distance or subtree changes and their edges, not to the
+        // graph. A removed vertex is handled as the removal of its edges; only compaction recomputes the tree from scratch.
+        // Allocator is the graph's edge allocator, so arena- and pool-backed graphs are tracked as well. Edge weights must be
+        // non-negative: a negative weight makes the mutating call throw std::invalid_argument and leaves the tree stale.
+        // The graph must outlive this object.
+        template <typename VertexType, typename WeightType, typename Allocator = std::allocator<WeightType>>
+        class DynamicDijkstra : public GraphObserver<WeightType> {
+        private:
+            GraphAdjacencyList<VertexType, WeightType, Allocator>& graph; // The graph being observed.
+            int sourceVertex;                                     // Source of the tree, or -1 once it has been removed.
+            std::vector<std::vector<std::pair<int, WeightType>>> incoming; // (tail, weight) of every edge into each vertex.
+            std::vector<WeightType> distances;                    // Distance from the source, or the maximum WeightType.
+            // The tree is kept as intrusive child lists so that re-parenting a vertex is O(1).
+            std::vector<int> parents;                             // Tree parent, or -1 for the source and unreachable vertices.
+            std::vector<int> firstChildren;                       // First tree child, or -1.
+            std::vector<int> nextSiblings;                        // Next child of the same parent, or -1.
+            std::vector<int> previousSiblings;                    // Previous child of the same parent, or -1.
+            std::vector<char> suspect;                            // Marks the subtree being checked after an increase.
+            std::vector<int> subtree;                             // Scratch list of the vertices of that subtree.
+            IndexedDaryHeap<WeightType, 4> queue;                 // Frontier of the repair searches; keys need not be monotone.
+            int updateWork;                                       // Vertices examined by the most recent update.
+
+            // The distance of unreachable vertices.
+            static constexpr WeightType none() {
+                return std::numeric_limits<WeightType>::max();
+            }
+
+            // Detaches a vertex from its tree parent.
+            void unlink(int vertex) {
+                int parent = parents[vertex];
+                if (parent == -1) {
+                    return;
+                }
+                if (previousSiblings[vertex] != -1) {
+                    nextSiblings[previousSiblings[vertex]] = nextSiblings[vertex];
+                } else {
+                    firstChildren[parent] = nextSiblings[vertex];
+                }
+                if (nextSiblings[vertex] != -1) {
+                    previousSiblings[nextSiblings[vertex]] = previousSiblings[vertex];
+                }
+                parents[vertex] = -1;
+                nextSiblings[vertex] = -1;
+                previousSiblings[vertex] = -1;
+            }
+
+            // Makes parent the tree parent of vertex, or detaches it for a parent of -1.
+            void setParent(int vertex, int parent) {
+                if (parents[vertex] == parent) {
+                    return;
+                }
+                unlink(vertex);
+                if (parent == -1) {
+                    return;
+                }
+                parents[vertex] = parent;
+                nextSiblings[vertex] = firstChildren[parent];
+                if (firstChildren[parent] != -1) {
+                    previousSiblings[firstChildren[parent]] = vertex;
+                }
+                firstChildren[parent] = vertex;
+            }
+
+            // Settles the vertices in the queue, relaxing their out-edges, until no distance drops any further.
+            void propagate() {
+                while (!queue.isEmpty()) {
+                    auto [distance, u] = queue.extractMin();
+                    ++updateWork;
+                    for (const auto& neighbor : neighborsOf(graph, u)) {
+                        int v = neighbor.first;
+                        WeightType candidate = distance + neighbor.second;
+                        if (candidate < distances[v]) {
+                            distances[v] = candidate;
+                            setParent(v, u);
+                            queue.push(v, candidate);
+                        }
+                    }
+                }
+            }
+
+            // Rebuilds the incoming edges and the whole tree from the graph.
+            void recompute() {
+                int numVertices = graph.vertexCount();
+                incoming.assign(numVertices, {});
+                for (int u = 0; u < numVertices; ++u) {
+                    for (const auto& edge : graph.getNeighbors(u)) {
+                        if (edge.second < 0) {
+                            throw std::invalid_argument("Dynamic Dijkstra requires non-negative edge weights");
+                        }
+                        incoming[edge.first].push_back({u, edge.second});
+                    }
+                }
+                distances.assign(numVertices, none());
+                parents.assign(numVertices, -1);
+                firstChildren.assign(numVertices, -1);
+                nextSiblings.assign(numVertices, -1);
+                previousSiblings.assign(numVertices, -1);
+                suspect.assign(numVertices, 0);
+                updateWork = 0;
+                queue.reset(numVertices);
+                if (sourceVertex != -1) {
+                    distances[sourceVertex] = 0;
+                    queue.push(sourceVertex, 0);
+                    propagate();
+                }
+            }
+
+            // Restores the tree after the edges from u to v changed; incoming already reflects the change.
+            void repair(int u, int v) {
+                updateWork = 0;
+                if (sourceVertex == -1 || u == v) {
+                    return;
+                }
+                // With parallel edges, only the cheapest one matters.
+                WeightType weight = none();
+                for (const auto& edge : incoming[v]) {
+                    if (edge.first == u) {
+                        weight = std::min(weight, edge.second);
+                    }
+                }
+                bool usable = distances[u] != none() && weight != none();
+                if (usable && distances[u] + weight < distances[v]) {
+                    distances[v] = distances[u] + weight;
+                    setParent(v, u);
+                    queue.reset(static_cast<int>(distances.size()));
+                    queue.push(v, distances[v]);
+                    propagate();
+                } else if (parents[v] == u && !(usable && distances[u] + weight == distances[v])) {
+                    raise(v);
+                }
+            }
+
+            // Repairs the subtree of a vertex whose tree edge got dearer or was removed.
+            void raise(int root) {
+                // Collect the subtree; only these vertices can be farther from the source now.
+                subtree.clear();
+                subtree.push_back(root);
+                suspect[root] = 1;
+                for (std::size_t i = 0; i < subtree.size(); ++i) {
+                    for (int child = firstChildren[subtree[i]]; child != -1; child = nextSiblings[child]) {
+                        subtree.push_back(child);
+                        suspect[child] = 1;
+                    }
+                }
+                updateWork = static_cast<int>(subtree.size());
+
+                // In order of old distance, a vertex keeps its distance if an unsuspected in-neighbour still offers it.
+                // Zero-weight ties may visit a child before its parent; the child is then treated as affected, which
+                // only costs work, since every distance is recomputed below.
+                std::sort(subtree.begin(), subtree.end(), [this](int a, int b) { return distances[a] < distances[b]; });
+                std::size_t numAffected = 0;
+                for (int vertex : subtree) {
+                    int support = -1;
+                    for (const auto& edge : incoming[vertex]) {
+                        int from = edge.first;
+                        if (!suspect[from] && distances[from] != none() && distances[from] + edge.second == distances[vertex]) {
+                            support = from;
+                            break;
+                        }
+                    }
+                    if (support != -1) {
+                        suspect[vertex] = 0;
+                        setParent(vertex, support);
+                    } else {
+                        subtree[numAffected++] = vertex;
+                    }
+                }
+                subtree.resize(numAffected);
+
+                // Affected vertices have no parent left outside the affected set; start each from its best unaffected in-neighbour.
+                for (int vertex : subtree) {
+                    unlink(vertex);
+                    distances[vertex] = none();
+                }
+                queue.reset(static_cast<int>(distances.size()));
+                for (int vertex : subtree) {
+                    suspect[vertex] = 0;
+                    WeightType best = none();
+                    int bestFrom = -1;
+                    for (const auto& edge : incoming[vertex]) {
+                        if (distances[edge.first] != none() && distances[edge.first] + edge.second < best) {
+                            best = distances[edge.first] + edge.second;
+                            bestFrom = edge.first;
+                        }
+                    }
+                    if (bestFrom != -1) {
+                        distances[vertex] = best;
+                        setParent(vertex, bestFrom);
+                        queue.push(vertex, best);
+                    }
+                }
+                propagate();
+            }
+
+        public:
+            // Computes the tree of the source and subscribes to the graph's mutations.
+            DynamicDijkstra(GraphAdjacencyList<VertexType, WeightType, Allocator>& graph, int source) : graph(graph), sourceVertex(source), updateWork(0) {
+                if (source < 0 || source >= graph.vertexCount()) {
+                    throw std::out_of_range("Vertex index out of range");
+                }
+                if (graph.isRemoved(source)) {
+                    throw std::out_of_range("Vertex has been removed");
+                }
+                recompute();
+                graph.subscribe(this);
+            }
+
+            // Unsubscribes from the graph.
+            ~DynamicDijkstra() {
+                graph.unsubscribe(this);
+            }
+
+            // The tree is tied to one subscription, so it can be neither copied nor moved.
+            DynamicDijkstra(const DynamicDijkstra&) = delete;
+            DynamicDijkstra& operator=(const DynamicDijkstra&) = delete;
+
+            // Returns the source vertex, or -1 if it has been removed from the graph.
+            int source() const {
+                return sourceVertex;
+            }
+
+            // Returns the shortest distance from the source to a vertex, or the maximum WeightType if it is unreachable.
+            WeightType distance(int vertex) const {
+                return distances[vertex];
+            }
+
+            // Returns the predecessor of a vertex in the tree, or -1 for the source and unreachable vertices.
+            int previous(int vertex) const {
+                return parents[vertex];
+            }
+
+            // Returns the current shortest path from the source to a destination.
+            ShortestPath<WeightType> path(int destination) const {
+                ShortestPath<WeightType> path;
+                if (distances[destination] == none()) {
+                    return path;
+                }
+                path.reachable = true;
+                path.totalWeight = distances[destination];
+                std::size_t length = 0;
+                for (int at = destination; at != -1; at = parents[at]) {
+                    ++length;
+                }
+                path.vertices.resize(length);
+                for (int at = destination; at != -1; at = parents[at]) {
+                    path.vertices[--length] = at;
+                }
+                return path;
+            }
+
+            // Returns a copy of the whole tree.
+            ShortestPathTree<WeightType> tree() const {
+                return {distances, parents};
+            }
+
+            // Returns the number of vertices examined by the most recent update, a measure of its repair cost.
+            int lastUpdateWork() const {
+                return updateWork;
+            }
+
+            // Graph notifications.
+            void vertexAdded(int vertexIndex) override {
+                updateWork = 0;
+                if (vertexIndex < static_cast<int>(distances.size())) {
+                    return; // A reused slot was left edgeless and unreachable by vertexRemoved.
+                }
+                incoming.emplace_back();
+                distances.push_back(none());
+                parents.push_back(-1);
+                firstChildren.push_back(-1);
+                nextSiblings.push_back(-1);
+                previousSiblings.push_back(-1);
+                suspect.push_back(0);
+            }
+
+            void vertexRemoved(int vertexIndex) override {
+                updateWork = 0;
+                if (vertexIndex == sourceVertex) {
+                    sourceVertex = -1;
+                    recompute();
+                    return;
+                }
+                // Its outgoing edges were already reported one by one, so it has no tree children left; only its own
+                // distance and the edges into it remain to be dropped.
+                incoming[vertexIndex].clear();
+                unlink(vertexIndex);
+                distances[vertexIndex] = none();
+            }
+
+            void verticesRenumbered(const std::vector<int>& newIndices) override {
+                if (sourceVertex != -1) {
+                    sourceVertex = newIndices[sourceVertex];
+                }
+                recompute();
+            }
+
+            void edgeAdded(int fromVertex, int toVertex, WeightType weight) override {
+                if (weight < 0) {
+                    throw std::invalid_argument("Dynamic Dijkstra requires non-negative edge weights");
+                }
+                incoming[toVertex].push_back({fromVertex, weight});
+                repair(fromVertex, toVertex);
+            }
+
+            void edgeRemoved(int fromVertex, int toVertex) override {
+                auto& edges = incoming[toVertex];
+                edges.erase(std::remove_if(edges.begin(), edges.end(), [fromVertex](const std::pair<int, WeightType>& edge) {
+                    return edge.first == fromVertex;
+                }), edges.end());
+                repair(fromVertex, toVertex);
+            }
+
+            void edgeWeightChanged(int fromVertex, int toVertex, WeightType weight) override {
+                if (weight < 0) {
+                    throw std::invalid_argument("Dynamic Dijkstra requires non-negative edge weights");
+                }
+                for (auto& edge : incoming[toVertex]) {
+                    if (edge.first == fromVertex) {
+                        edge.second = weight;
+                    }
+                }
+                repair(fromVertex, toVertex);
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // DYNAMICDIJKSTRA_H
@@ -1,11 +1,19 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef GRAPH_H
 #define GRAPH_H
 
 #include <vector>
 #include <iostream>
+#include <atomic>
+
+// Returns a graph version number that no earlier call in this process has returned. Mutable graphs take a fresh one when
+// constructed and after every mutation, so two graph states with the same version have the same contents, even across copies.
+inline unsigned long long nextGraphVersion() {
+    static std::atomic<unsigned long long> counter(0);
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
 
 template <typename VertexType, typename WeightType>
 class Graph {
@@ -15,7 +23,7 @@ public:
     // Add a vertex to the graph and return its index
     virtual int addVertex(VertexType vertex) = 0;
 
-    // Remove a vertex from the graph
+    // Remove a vertex from the graph; mutable backends leave a tombstone so that other indices stay valid
     virtual void removeVertex(int vertexIndex) = 0;
 
     // Add an edge between two vertices with a weight
@@ -30,7 +38,10 @@ public:
     // Get the weight of an edge between two vertices
     virtual WeightType getEdgeWeight(int fromVertex, int toVertex) const = 0;
 
-    // Get number of vertices in the graph
+    // Get the vertex stored at the given index
+    virtual VertexType getVertex(int vertexIndex) const = 0;
+
+    // Get number of vertex indices in the graph, including removed vertices that still hold their index
     virtual int vertexCount() const = 0;
 
     // Print the graph in a readable format
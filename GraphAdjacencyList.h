@@ -1,12 +1,15 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef GRAPHADJACENCYLIST_H
 #define GRAPHADJACENCYLIST_H
 
 #include "Graph.h"
+#include "GraphObserver.h"
+#include "NodeAllocator.h"
 #include <vector>
 #include <list>
+#include <memory>
 #include <algorithm>
 #include <stdexcept>
 #include <iomanip>
@@ -14,73 +17,201 @@
 
 // Template class for GraphAdjacencyList, implementing the graph using an adjacency list representation.
 // VertexType defines the type of the vertices, and WeightType defines the type for edge weights.
-template <typename VertexType, typename WeightType>
+// Removing a vertex leaves a tombstone: its index stays reserved, its outgoing edges are freed and the edges into it are
+// left in place but no longer reported. Each slot carries a generation that removal advances and every edge records the
+// generation of its target, so an edge into a removed vertex stays dead even after addVertex reuses the slot from the
+// free-list. compact() renumbers the surviving vertices densely and drops dead edges in one pass.
+// Allocator supplies the edge nodes and is rebound to the node type. With an ArenaAllocator or PoolAllocator, edges are
+// carved from shared chunks instead of allocated one by one, which speeds up building large graphs and shrinks their
+// footprint, and a whole graph's edges are freed by releasing the resource.
+template <typename VertexType, typename WeightType, typename Allocator = std::allocator<WeightType>>
 class GraphAdjacencyList : public Graph<VertexType, WeightType> {
 private:
-    // Each vertex's edges are stored in a list of pairs, where each pair consists of the target vertex index and the edge weight.
-    std::vector<std::list<std::pair<int, WeightType>>> adjacencyList;
+    // One stored edge.
+    struct Edge {
+        int target;              // Index of the target vertex.
+        unsigned int generation; // Generation of the target's slot when the edge was added.
+        WeightType weight;       // Weight of the edge.
+    };
+
+    using EdgeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Edge>;
+
+    // Source of the edge nodes.
+    EdgeAllocator edgeAllocator;
+    // Each vertex's edges are stored in a list.
+    std::vector<std::list<Edge, EdgeAllocator>> adjacencyList;
     // Dynamic array of vertices allows direct access to vertices based on their indices.
     std::vector<VertexType> vertices;
-    // Tracks the current number of vertices in the graph.
+    // Generation of every slot; it advances each time the slot's vertex is removed.
+    std::vector<unsigned int> generations;
+    // Whether each slot currently holds a removed vertex.
+    std::vector<char> removed;
+    // Removed slots available for reuse by addVertex.
+    std::vector<int> freeSlots;
+    // Tracks the current number of vertex slots, removed ones included.
     int numVertices;
+    // Objects notified after every mutation, such as incremental shortest-path trees.
+    GraphObserverList<WeightType> observers;
+    // Version of the current contents; see nextGraphVersion().
+    unsigned long long contentVersion;
+
+    // Checks if a stored edge still leads to the vertex it was added for.
+    bool isLive(const Edge& edge) const {
+        return edge.generation == generations[edge.target];
+    }
+
+    // Throws unless the index names a vertex that has not been removed.
+    void checkVertex(int vertexIndex) const {
+        if (vertexIndex < 0 || vertexIndex >= numVertices) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        if (removed[vertexIndex]) {
+            throw std::out_of_range("Vertex has been removed");
+        }
+    }
 
 public:
-    // Constructor initializes an empty graph with zero vertices.
-    GraphAdjacencyList() : numVertices(0) {}
+    // Constructor initializes an empty graph with zero vertices, drawing edge nodes from the given allocator.
+    explicit GraphAdjacencyList(const Allocator& allocator = Allocator())
+        : edgeAllocator(allocator), numVertices(0), contentVersion(nextGraphVersion()) {}
 
     // Destructor is trivial as the STL containers handle their own memory management.
     virtual ~GraphAdjacencyList() {}
 
-    // Adds a vertex to the graph and returns the index where it was added.
+    // Adds a vertex to the graph and returns its index, reusing the slot of a removed vertex when one is free.
     int addVertex(VertexType vertex) override {
-        vertices.push_back(vertex); // Add the vertex to the list of vertices.
-        adjacencyList.emplace_back(); // Initialize an empty adjacency list for the new vertex.
-        return numVertices++; // Return the index of the newly added vertex and increment the count.
+        int vertexIndex;
+        if (!freeSlots.empty()) {
+            vertexIndex = freeSlots.back();
+            freeSlots.pop_back();
+            vertices[vertexIndex] = vertex;
+            removed[vertexIndex] = 0;
+        } else {
+            vertices.push_back(vertex); // Add the vertex to the list of vertices.
+            adjacencyList.emplace_back(edgeAllocator); // Initialize an empty adjacency list for the new vertex.
+            generations.push_back(0);
+            removed.push_back(0);
+            vertexIndex = numVertices++; // Index of the newly added vertex.
+        }
+        contentVersion = nextGraphVersion();
+        observers.notify([vertexIndex](GraphObserver<WeightType>& observer) { observer.vertexAdded(vertexIndex); });
+        return vertexIndex;
     }
 
-    // Removes a vertex from the graph along with all edges associated with it.
+    // Removes a vertex along with all edges associated with it, in time proportional to its out-degree.
+    // Other indices do not change; the slot is reused by a later addVertex or reclaimed by compact().
+    // The outgoing edges are reported to observers through edgeRemoved before the vertex itself through vertexRemoved.
     void removeVertex(int vertexIndex) override {
-        if (vertexIndex < 0 || vertexIndex >= numVertices) {
-            throw std::out_of_range("Vertex index out of range");
+        checkVertex(vertexIndex);
+        std::vector<int> targets; // Distinct live targets of the outgoing edges.
+        for (const auto& edge : adjacencyList[vertexIndex]) {
+            if (isLive(edge)) {
+                targets.push_back(edge.target);
+            }
+        }
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+        adjacencyList[vertexIndex].clear();
+        for (int target : targets) {
+            observers.notify([=](GraphObserver<WeightType>& observer) { observer.edgeRemoved(vertexIndex, target); });
         }
 
-        // Erase the vertex and its adjacency list.
-        vertices.erase(vertices.begin() + vertexIndex);
-        adjacencyList.erase(adjacencyList.begin() + vertexIndex);
-        --numVertices;
+        // Advancing the generation kills every edge into the vertex without visiting it.
+        ++generations[vertexIndex];
+        removed[vertexIndex] = 1;
+        freeSlots.push_back(vertexIndex);
+        contentVersion = nextGraphVersion();
+        observers.notify([vertexIndex](GraphObserver<WeightType>& observer) { observer.vertexRemoved(vertexIndex); });
+    }
 
-        // Update indices in adjacency lists of remaining vertices.
-        for (auto& list : adjacencyList) {
+    // Renumbers the remaining vertices densely, keeping their order, and frees every edge into a removed vertex.
+    // Returns the mapping from old to new indices, with -1 for removed vertices. Runs in O(V + E).
+    std::vector<int> compact() {
+        std::vector<int> newIndices(numVertices, -1);
+        int numLive = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            if (!removed[v]) {
+                newIndices[v] = numLive++;
+            }
+        }
+        for (int v = 0; v < numVertices; ++v) {
+            if (newIndices[v] == -1) {
+                continue;
+            }
+            auto& list = adjacencyList[v];
             for (auto it = list.begin(); it != list.end();) {
-                if (it->first == vertexIndex) {
-                    it = list.erase(it); // Remove edges pointing to the removed vertex.
+                if (!isLive(*it)) {
+                    it = list.erase(it); // Remove edges pointing to removed vertices.
                 } else {
-                    if (it->first > vertexIndex) {
-                        it->first--; // Adjust the indices of vertices that come after the removed vertex.
-                    }
+                    it->target = newIndices[it->target];
+                    it->generation = 0;
                     ++it;
                 }
             }
+            // Slots only move down, so the destination has already been vacated or is the same slot.
+            if (newIndices[v] != v) {
+                adjacencyList[newIndices[v]] = std::move(list);
+                vertices[newIndices[v]] = std::move(vertices[v]);
+            }
         }
+        adjacencyList.erase(adjacencyList.begin() + numLive, adjacencyList.end());
+        vertices.resize(numLive);
+        generations.assign(numLive, 0);
+        removed.assign(numLive, 0);
+        freeSlots.clear();
+        numVertices = numLive;
+        contentVersion = nextGraphVersion();
+        observers.notify([&newIndices](GraphObserver<WeightType>& observer) { observer.verticesRenumbered(newIndices); });
+        return newIndices;
     }
 
     // Adds an edge between two specified vertices with a given weight.
     void addEdge(int fromVertex, int toVertex, WeightType weight) override {
-        adjacencyList[fromVertex].push_back({toVertex, weight}); // Add the edge to the adjacency list of the fromVertex.
+        checkVertex(fromVertex);
+        checkVertex(toVertex);
+        adjacencyList[fromVertex].push_back({toVertex, generations[toVertex], weight}); // Add the edge to the adjacency list of the fromVertex.
+        contentVersion = nextGraphVersion();
+        observers.notify([=](GraphObserver<WeightType>& observer) { observer.edgeAdded(fromVertex, toVertex, weight); });
     }
 
     // Removes an edge between two specified vertices.
     void removeEdge(int fromVertex, int toVertex) override {
-        adjacencyList[fromVertex].remove_if([toVertex](const std::pair<int, WeightType>& edge) {
-            return edge.first == toVertex; // Remove the edge if the target vertex matches toVertex.
+        checkVertex(fromVertex);
+        bool found = false;
+        adjacencyList[fromVertex].remove_if([&](const Edge& edge) {
+            found = found || (edge.target == toVertex && isLive(edge));
+            return edge.target == toVertex; // Remove the edge if the target vertex matches toVertex; dead edges to the slot go too.
         });
+        if (found) {
+            contentVersion = nextGraphVersion();
+            observers.notify([=](GraphObserver<WeightType>& observer) { observer.edgeRemoved(fromVertex, toVertex); });
+        }
+    }
+
+    // Sets the weight of the edge between two specified vertices, or of every such edge if there are several.
+    void updateEdgeWeight(int fromVertex, int toVertex, WeightType weight) {
+        checkVertex(fromVertex);
+        bool found = false;
+        for (auto& edge : adjacencyList[fromVertex]) {
+            if (edge.target == toVertex && isLive(edge)) {
+                edge.weight = weight;
+                found = true;
+            }
+        }
+        if (!found) {
+            throw std::range_error("Edge does not exist");
+        }
+        contentVersion = nextGraphVersion();
+        observers.notify([=](GraphObserver<WeightType>& observer) { observer.edgeWeightChanged(fromVertex, toVertex, weight); });
     }
 
-    // Retrieves a list of all neighbors and their edge weights for a given vertex.
+    // Retrieves a list of all neighbors and their edge weights for a given vertex, skipping edges into removed vertices.
     std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const override {
         std::vector<std::pair<int, WeightType>> neighbors;
         for (const auto& edge : adjacencyList[vertex]) {
-            neighbors.push_back(edge); // Collect all edges of the vertex.
+            if (isLive(edge)) {
+                neighbors.emplace_back(edge.target, edge.weight); // Collect all edges of the vertex.
+            }
         }
         return neighbors;
     }
@@ -88,25 +219,63 @@ public:
     // Retrieves the weight of an edge between two specified vertices.
     WeightType getEdgeWeight(int fromVertex, int toVertex) const override {
         for (const auto& edge : adjacencyList[fromVertex]) {
-            if (edge.first == toVertex) {
-                return edge.second; // Return the weight of the edge.
+            if (edge.target == toVertex && isLive(edge)) {
+                return edge.weight; // Return the weight of the edge.
             }
         }
         throw std::range_error("Edge does not exist");
     }
 
-    // Returns the current number of vertices in the graph.
+    // Returns the vertex stored at the given index. A removed vertex keeps its value until its slot is reused or compacted.
+    VertexType getVertex(int vertexIndex) const override {
+        if (vertexIndex < 0 || vertexIndex >= numVertices) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return vertices[vertexIndex];
+    }
+
+    // Checks if the vertex at an index has been removed.
+    bool isRemoved(int vertexIndex) const {
+        return removed[vertexIndex] != 0;
+    }
+
+    // Registers an observer to be notified after every mutation; the observer must unsubscribe before it is destroyed.
+    void subscribe(GraphObserver<WeightType>* observer) {
+        observers.subscribe(observer);
+    }
+
+    // Stops notifying an observer.
+    void unsubscribe(GraphObserver<WeightType>* observer) {
+        observers.unsubscribe(observer);
+    }
+
+    // Returns the number of vertex slots, which bounds every vertex index; removed vertices keep theirs until compact().
     int vertexCount() const override {
         return numVertices;
     }
 
+    // Returns the number of vertices that have not been removed.
+    int liveVertexCount() const {
+        return numVertices - static_cast<int>(freeSlots.size());
+    }
+
+    // Returns the version of the graph's contents, which changes with every mutation; caches compare it to detect stale results.
+    unsigned long long version() const {
+        return contentVersion;
+    }
+
     // Prints the entire adjacency list along with vertex identifiers.
     void print() const override {
         std::cout << "Graph (Adjacency List Representation):" << std::endl;
-        for (int i = 0; i < vertices.size(); ++i) {
+        for (int i = 0; i < numVertices; ++i) {
+            if (removed[i]) {
+                continue;
+            }
             std::cout << vertices[i] << " -> ";
             for (const auto& edge : adjacencyList[i]) {
-                std::cout << "(" << vertices[edge.first] << ", " << std::fixed << std::setprecision(1) << round(edge.second * 10) / 10 << ") ";
+                if (isLive(edge)) {
+                    std::cout << "(" << vertices[edge.target] << ", " << std::fixed << std::setprecision(1) << round(edge.weight * 10) / 10 << ") ";
+                }
             }
             std::cout << std::endl;
         }
@@ -1,5 +1,5 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef GRAPHADJACENCYMATRIX_H
 #define GRAPHADJACENCYMATRIX_H
@@ -10,102 +10,244 @@
 #include <stdexcept>
 #include <iomanip>
 #include <cmath>
+#include <new>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 // Template class defining a graph using an adjacency matrix representation.
 // VertexType and WeightType are template parameters allowing for flexible vertex identifiers and edge weights.
+// The matrix is one 64-byte aligned buffer whose rows are padded to a whole number of 64-byte blocks, so every row
+// starts on a cache line. Neighbor scans compare a block at a time (with AVX2 when the compiler targets it) and, when
+// occupancy tracking is on, skip every block that a per-row bitmap marks as holding no edges.
+// Removing a vertex clears its row and column in O(V) and leaves a tombstone: other indices do not move, and the slot goes
+// to a free-list for addVertex to reuse. compact() renumbers the surviving vertices densely in one O(V^2) pass.
 template <typename VertexType, typename WeightType>
 class GraphAdjacencyMatrix : public Graph<VertexType, WeightType> {
 private:
-    // Pointer to a pointer representing a 2D array, which is the adjacency matrix itself.
-    // Each element stores the weight of the edge between two vertices.
-    WeightType** matrix;   
-    // Dynamic array for storing vertices, allowing lookup of vertex values based on their indices.
-    VertexType* vertices;  
+    // Alignment of the matrix buffer and width of one scanned block, in bytes.
+    static constexpr std::size_t BlockBytes = 64;
+    // Number of matrix cells in one block.
+    static constexpr int BlockWidth = sizeof(WeightType) < BlockBytes ? static_cast<int>(BlockBytes / sizeof(WeightType)) : 1;
+
+    // Flat row-major matrix; the weight of the edge from i to j lives at matrix[i * stride + j].
+    WeightType* matrix;
+    // Number of cells per row: the capacity rounded up to a whole number of blocks.
+    int stride;
+    // Per-row occupancy bitmap: bit b of a row is set when block b of that row may hold an edge.
+    std::vector<std::uint64_t> occupancy;
+    // Number of 64-bit words of the occupancy bitmap per row.
+    int occupancyWords;
+    // Whether the occupancy bitmap is maintained and used to skip empty blocks.
+    bool trackOccupancy;
+    // Vertices by index, allowing lookup of vertex values based on their indices.
+    std::vector<VertexType> vertices;
+    // Whether each slot currently holds a removed vertex.
+    std::vector<char> removed;
+    // Removed slots available for reuse by addVertex.
+    std::vector<int> freeSlots;
     // Current capacity of the graph, indicating the maximum number of vertices the graph can accommodate without resizing.
-    int capacity;          
+    int capacity;
     // The current number of vertices in the graph.
-    int numVertices;       
+    int numVertices;
+    // The current number of edges in the graph.
+    long long numEdges;
     // Represents the value used to indicate no edge exists between two vertices.
     WeightType noEdgeValue;
+    // Version of the current contents; see nextGraphVersion().
+    unsigned long long contentVersion;
 
 public:
     // Constructor for initializing the graph with a specified capacity and a default value for non-existent edges.
-    GraphAdjacencyMatrix(int initCapacity = 10, WeightType noEdgeValue = std::numeric_limits<WeightType>::max())
-        : capacity(initCapacity), numVertices(0), noEdgeValue(noEdgeValue) {
-        vertices = new VertexType[capacity];
-        matrix = new WeightType*[capacity];
-        for (int i = 0; i < capacity; i++) {
-            matrix[i] = new WeightType[capacity];
-            std::fill(matrix[i], matrix[i] + capacity, noEdgeValue); // Fill the matrix with noEdgeValue indicating no edges initially.
+    // trackOccupancy keeps a per-row bitmap of non-empty blocks; it speeds up scans of sparse rows at a small cost per edge update.
+    GraphAdjacencyMatrix(int initCapacity = 10, WeightType noEdgeValue = std::numeric_limits<WeightType>::max(), bool trackOccupancy = true)
+        : matrix(nullptr), stride(0), occupancyWords(0), trackOccupancy(trackOccupancy), capacity(0), numVertices(0), numEdges(0), noEdgeValue(noEdgeValue),
+          contentVersion(nextGraphVersion()) {
+        allocate(std::max(initCapacity, 1));
+    }
+
+    // Copy constructor duplicating the matrix buffer.
+    GraphAdjacencyMatrix(const GraphAdjacencyMatrix& other)
+        : matrix(nullptr), stride(0), occupancyWords(0), trackOccupancy(other.trackOccupancy), capacity(0), numVertices(0),
+          numEdges(other.numEdges), noEdgeValue(other.noEdgeValue), contentVersion(other.contentVersion) {
+        allocate(other.capacity);
+        std::copy(other.matrix, other.matrix + static_cast<std::size_t>(stride) * capacity, matrix);
+        occupancy = other.occupancy;
+        vertices = other.vertices;
+        removed = other.removed;
+        freeSlots = other.freeSlots;
+        numVertices = other.numVertices;
+    }
+
+    // Copy assignment operator using copy-and-swap.
+    GraphAdjacencyMatrix& operator=(const GraphAdjacencyMatrix& other) {
+        if (this != &other) {
+            GraphAdjacencyMatrix copy(other);
+            swap(copy);
         }
+        return *this;
     }
 
-    // Destructor to clean up dynamically allocated memory, preventing memory leaks.
+    // Destructor releasing the matrix buffer.
     virtual ~GraphAdjacencyMatrix() {
-        for (int i = 0; i < capacity; i++) {
-            delete[] matrix[i]; // Delete each sub-array (row of the matrix).
-        }
-        delete[] matrix; // Delete the array of pointers.
-        delete[] vertices; // Delete the array of vertices.
+        release(matrix);
     }
 
-    // Adds a new vertex to the graph, resizing if necessary.
+    // Adds a new vertex to the graph, reusing the slot of a removed vertex when one is free and resizing if necessary.
     int addVertex(VertexType vertex) override {
+        contentVersion = nextGraphVersion();
+        // Reused and fresh rows and columns are already noEdgeValue: cells are filled on allocation and cleared on removal.
+        if (!freeSlots.empty()) {
+            int vertexIndex = freeSlots.back();
+            freeSlots.pop_back();
+            vertices[vertexIndex] = vertex;
+            removed[vertexIndex] = 0;
+            return vertexIndex;
+        }
         if (numVertices == capacity) {
             resize(); // Resize the graph's data structures if capacity is reached.
         }
-        vertices[numVertices] = vertex;
-        for (int i = 0; i <= numVertices; i++) {
-            matrix[i][numVertices] = noEdgeValue; // Initialize new column to noEdgeValue.
-            matrix[numVertices][i] = noEdgeValue; // Initialize new row to noEdgeValue.
-        }
+        vertices.push_back(vertex);
+        removed.push_back(0);
         return numVertices++; // Return the index of the newly added vertex and increment the vertex count.
     }
 
-    // Removes a vertex and its associated edges from the graph.
+    // Removes a vertex and its associated edges from the graph by clearing its row and column in O(V).
+    // Other indices do not change; the slot is reused by a later addVertex or reclaimed by compact().
     void removeVertex(int vertexIndex) override {
         if (vertexIndex < 0 || vertexIndex >= numVertices) {
             throw std::out_of_range("Vertex index out of range");
         }
-        // Shift matrix columns left to remove the column associated with the vertex.
+        if (removed[vertexIndex]) {
+            throw std::out_of_range("Vertex has been removed");
+        }
+        // Discount and clear the edges entering the vertex, then those leaving it, so a self-loop is counted once.
+        WeightType* vertexRow = rowOf(vertexIndex);
         for (int i = 0; i < numVertices; i++) {
-            for (int j = vertexIndex; j < numVertices - 1; j++) {
-                matrix[i][j] = matrix[i][j + 1];
+            WeightType& cell = rowOf(i)[vertexIndex];
+            if (cell != noEdgeValue) {
+                cell = noEdgeValue;
+                --numEdges;
+                if (trackOccupancy) {
+                    updateOccupancy(i, vertexIndex / BlockWidth);
+                }
             }
         }
-        // Shift matrix rows up to remove the row associated with the vertex.
-        for (int i = vertexIndex; i < numVertices - 1; i++) {
-            for (int j = 0; j < numVertices; j++) {
-                matrix[i][j] = matrix[i + 1][j];
+        for (int i = 0; i < numVertices; i++) {
+            numEdges -= vertexRow[i] != noEdgeValue;
+        }
+        std::fill(vertexRow, vertexRow + numVertices, noEdgeValue);
+        if (trackOccupancy) {
+            std::fill(occupancyRow(vertexIndex), occupancyRow(vertexIndex) + occupancyWords, 0);
+        }
+        removed[vertexIndex] = 1;
+        freeSlots.push_back(vertexIndex);
+        contentVersion = nextGraphVersion();
+    }
+
+    // Renumbers the remaining vertices densely, keeping their order, by moving every surviving row and column down in one pass.
+    // Returns the mapping from old to new indices, with -1 for removed vertices.
+    std::vector<int> compact() {
+        std::vector<int> newIndices(numVertices, -1);
+        std::vector<int> liveColumns; // Old indices of the surviving vertices, in order.
+        for (int v = 0; v < numVertices; v++) {
+            if (!removed[v]) {
+                newIndices[v] = static_cast<int>(liveColumns.size());
+                liveColumns.push_back(v);
             }
         }
-        // Shift vertices array to fill the gap.
-        for (int i = vertexIndex; i < numVertices - 1; i++) {
-            vertices[i] = vertices[i + 1];
+        int numLive = static_cast<int>(liveColumns.size());
+        // Rows and columns only move down, so each row can be gathered in place and then moved to its earlier slot.
+        // Every cell left behind is cleared; removed rows were cleared already, so the matrix ends up clean past numLive.
+        for (int i = 0; i < numLive; i++) {
+            WeightType* from = rowOf(liveColumns[i]);
+            for (int j = 0; j < numLive; j++) {
+                from[j] = from[liveColumns[j]];
+            }
+            std::fill(from + numLive, from + numVertices, noEdgeValue);
+            if (liveColumns[i] != i) {
+                std::copy(from, from + numLive, rowOf(i));
+                std::fill(from, from + numLive, noEdgeValue);
+            }
+            vertices[i] = std::move(vertices[liveColumns[i]]);
+        }
+        vertices.resize(numLive);
+        removed.assign(numLive, 0);
+        freeSlots.clear();
+        contentVersion = nextGraphVersion();
+        int oldNumVertices = numVertices;
+        numVertices = numLive;
+        if (trackOccupancy) {
+            for (int i = 0; i < oldNumVertices; i++) {
+                rebuildOccupancy(i);
+            }
         }
-        numVertices--; // Decrement the number of vertices.
+        return newIndices;
     }
 
     // Adds an edge between two specified vertices with a given weight.
     void addEdge(int fromVertex, int toVertex, WeightType weight) override {
-        if (fromVertex < numVertices && toVertex < numVertices) {
-            matrix[fromVertex][toVertex] = weight; // Set the weight of the edge in the matrix.
+        if (fromVertex < numVertices && toVertex < numVertices && !removed[fromVertex] && !removed[toVertex]) {
+            numEdges += (weight != noEdgeValue) - (rowOf(fromVertex)[toVertex] != noEdgeValue);
+            rowOf(fromVertex)[toVertex] = weight; // Set the weight of the edge in the matrix.
+            contentVersion = nextGraphVersion();
+            if (trackOccupancy) {
+                if (weight != noEdgeValue) {
+                    occupancyRow(fromVertex)[(toVertex / BlockWidth) / 64] |= std::uint64_t(1) << ((toVertex / BlockWidth) % 64);
+                } else {
+                    updateOccupancy(fromVertex, toVertex / BlockWidth);
+                }
+            }
         }
     }
 
     // Removes an edge between two specified vertices by setting its weight to noEdgeValue.
     void removeEdge(int fromVertex, int toVertex) override {
         if (fromVertex < numVertices && toVertex < numVertices) {
-            matrix[fromVertex][toVertex] = noEdgeValue;
+            if (rowOf(fromVertex)[toVertex] != noEdgeValue) {
+                --numEdges;
+                contentVersion = nextGraphVersion();
+            }
+            rowOf(fromVertex)[toVertex] = noEdgeValue;
+            if (trackOccupancy) {
+                updateOccupancy(fromVertex, toVertex / BlockWidth);
+            }
         }
     }
 
     // Retrieves a list of all neighbors and their edge weights for a given vertex.
     std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const override {
         std::vector<std::pair<int, WeightType>> neighbors;
-        for (int i = 0; i < numVertices; i++) {
-            if (matrix[vertex][i] != noEdgeValue) {
-                neighbors.emplace_back(i, matrix[vertex][i]);
+        const WeightType* row = rowOf(vertex);
+        int numBlocks = (numVertices + BlockWidth - 1) / BlockWidth;
+        // Appends the edges of one block, walking the set bits of its mask.
+        auto scanBlock = [&](int block) {
+            std::uint64_t mask = blockMask(row + block * BlockWidth);
+            while (mask != 0) {
+                int column = block * BlockWidth + lowestBit(mask);
+                mask &= mask - 1;
+                if (column < numVertices) {
+                    neighbors.emplace_back(column, row[column]);
+                }
+            }
+        };
+        if (trackOccupancy) {
+            const std::uint64_t* bits = occupancyRow(vertex);
+            for (int word = 0; word < occupancyWords; word++) {
+                for (std::uint64_t live = bits[word]; live != 0; live &= live - 1) {
+                    int block = word * 64 + lowestBit(live);
+                    if (block < numBlocks) {
+                        scanBlock(block);
+                    }
+                }
+            }
+        } else {
+            for (int block = 0; block < numBlocks; block++) {
+                scanBlock(block);
             }
         }
         return neighbors;
@@ -114,32 +256,78 @@ public:
     // Retrieves the weight of an edge between two specified vertices.
     WeightType getEdgeWeight(int fromVertex, int toVertex) const override {
         if (fromVertex < numVertices && toVertex < numVertices) {
-            return matrix[fromVertex][toVertex];
+            return rowOf(fromVertex)[toVertex];
         }
         return noEdgeValue;
     }
 
-    // Returns the current number of vertices in the graph.
+    // Returns the row of a vertex: numVertices contiguous edge weights, noEdgeValue where there is no edge, followed by
+    // noEdgeValue padding up to the next 64-byte boundary. The row starts 64-byte aligned.
+    const WeightType* row(int vertex) const {
+        return rowOf(vertex);
+    }
+
+    // Returns the value marking a missing edge.
+    WeightType noEdge() const {
+        return noEdgeValue;
+    }
+
+    // Returns the vertex stored at the given index. A removed vertex keeps its value until its slot is reused or compacted.
+    VertexType getVertex(int vertexIndex) const override {
+        if (vertexIndex < 0 || vertexIndex >= numVertices) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return vertices[vertexIndex];
+    }
+
+    // Checks if the vertex at an index has been removed.
+    bool isRemoved(int vertexIndex) const {
+        return removed[vertexIndex] != 0;
+    }
+
+    // Returns the number of vertex slots, which bounds every vertex index; removed vertices keep theirs until compact().
     int vertexCount() const override {
         return numVertices;
     }
 
+    // Returns the number of vertices that have not been removed.
+    int liveVertexCount() const {
+        return numVertices - static_cast<int>(freeSlots.size());
+    }
+
+    // Returns the current number of edges in the graph.
+    long long edgeCount() const {
+        return numEdges;
+    }
+
+    // Returns the version of the graph's contents, which changes with every mutation; caches compare it to detect stale results.
+    unsigned long long version() const {
+        return contentVersion;
+    }
+
     // Prints the entire adjacency matrix along with vertex identifiers.
     void print() const override {
         std::cout << "Graph (Adjacency Matrix Representation):" << std::endl;
         std::cout << "   ";
         for (int i = 0; i < numVertices; i++) {
-            std::cout << " " << vertices[i] << "  ";
+            if (!removed[i]) {
+                std::cout << " " << vertices[i] << "  ";
+            }
         }
         std::cout << std::endl;
 
         for (int i = 0; i < numVertices; i++) {
+            if (removed[i]) {
+                continue;
+            }
             std::cout << vertices[i] << ": ";
             for (int j = 0; j < numVertices; j++) {
-                if (matrix[i][j] == noEdgeValue) {
+                if (removed[j]) {
+                    continue;
+                } else if (rowOf(i)[j] == noEdgeValue) {
                     std::cout << "___ ";  // Represent no edge with "___".
                 } else {
-                    std::cout << std::fixed << std::setprecision(1) << round(matrix[i][j] * 10) / 10 << " "; // Format edge weights for readability.
+                    std::cout << std::fixed << std::setprecision(1) << round(rowOf(i)[j] * 10) / 10 << " "; // Format edge weights for readability.
                 }
             }
             std::cout << std::endl;
@@ -147,35 +335,161 @@ public:
     }
 
 private:
-    // Resizes the graph's data structures to accommodate more vertices.
-    void resize() {
-        int newCapacity = capacity * 2; // Double the current capacity.
-        VertexType* newVertices = new VertexType[newCapacity];
-        WeightType** newMatrix = new WeightType*[newCapacity];
+    // Returns a pointer to the first cell of a row.
+    WeightType* rowOf(int vertex) {
+        return matrix + static_cast<std::size_t>(vertex) * stride;
+    }
 
-        for (int i = 0; i < newCapacity; i++) {
-            newMatrix[i] = new WeightType[newCapacity];
-            std::fill(newMatrix[i], newMatrix[i] + newCapacity, noEdgeValue); // Initialize new matrix rows with noEdgeValue.
+    const WeightType* rowOf(int vertex) const {
+        return matrix + static_cast<std::size_t>(vertex) * stride;
+    }
+
+    // Returns a pointer to the occupancy bitmap of a row.
+    std::uint64_t* occupancyRow(int vertex) {
+        return occupancy.data() + static_cast<std::size_t>(vertex) * occupancyWords;
+    }
+
+    const std::uint64_t* occupancyRow(int vertex) const {
+        return occupancy.data() + static_cast<std::size_t>(vertex) * occupancyWords;
+    }
+
+    // Returns the index of the lowest set bit of a non-zero mask.
+    static int lowestBit(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(mask);
+#else
+        int bit = 0;
+        while ((mask & 1) == 0) {
+            mask >>= 1;
+            ++bit;
         }
+        return bit;
+#endif
+    }
 
-        for (int i = 0; i < numVertices; i++) {
-            newVertices[i] = vertices[i];
-            for (int j = 0; j < numVertices; j++) {
-                newMatrix[i][j] = matrix[i][j];
+    // Returns a mask with bit k set when cell k of the block starting at cells differs from noEdgeValue.
+    // With AVX2, 4- and 8-byte weights are compared a 32-byte vector at a time and the lane results packed with movemask;
+    // other builds and weight types compare cell by cell.
+    std::uint64_t blockMask(const WeightType* cells) const {
+#if defined(__AVX2__)
+        if constexpr (std::is_same<WeightType, float>::value) {
+            __m256 none = _mm256_set1_ps(noEdgeValue);
+            std::uint64_t low = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(cells), none, _CMP_NEQ_UQ));
+            std::uint64_t high = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_load_ps(cells + 8), none, _CMP_NEQ_UQ));
+            return low | (high << 8);
+        } else if constexpr (std::is_same<WeightType, double>::value) {
+            __m256d none = _mm256_set1_pd(noEdgeValue);
+            std::uint64_t low = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_load_pd(cells), none, _CMP_NEQ_UQ));
+            std::uint64_t high = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_load_pd(cells + 4), none, _CMP_NEQ_UQ));
+            return low | (high << 4);
+        } else if constexpr (std::is_integral<WeightType>::value && sizeof(WeightType) == 4) {
+            __m256i none = _mm256_set1_epi32(static_cast<int>(noEdgeValue));
+            const __m256i* vectors = reinterpret_cast<const __m256i*>(cells);
+            std::uint64_t low = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_load_si256(vectors), none)));
+            std::uint64_t high = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_load_si256(vectors + 1), none)));
+            return ~(low | (high << 8)) & 0xFFFFu; // Equal lanes are the empty cells.
+        } else if constexpr (std::is_integral<WeightType>::value && sizeof(WeightType) == 8) {
+            __m256i none = _mm256_set1_epi64x(static_cast<long long>(noEdgeValue));
+            const __m256i* vectors = reinterpret_cast<const __m256i*>(cells);
+            std::uint64_t low = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_load_si256(vectors), none)));
+            std::uint64_t high = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_load_si256(vectors + 1), none)));
+            return ~(low | (high << 4)) & 0xFFu;
+        }
+#endif
+        std::uint64_t mask = 0;
+        for (int k = 0; k < BlockWidth; k++) {
+            if (cells[k] != noEdgeValue) {
+                mask |= std::uint64_t(1) << k;
             }
         }
+        return mask;
+    }
+
+    // Sets or clears the occupancy bit of one block of a row according to its current contents.
+    void updateOccupancy(int vertex, int block) {
+        std::uint64_t bit = std::uint64_t(1) << (block % 64);
+        std::uint64_t& word = occupancyRow(vertex)[block / 64];
+        word = blockMask(rowOf(vertex) + block * BlockWidth) != 0 ? (word | bit) : (word & ~bit);
+    }
+
+    // Recomputes the whole occupancy bitmap of a row.
+    void rebuildOccupancy(int vertex) {
+        std::fill(occupancyRow(vertex), occupancyRow(vertex) + occupancyWords, 0);
+        for (int block = 0; block < stride / BlockWidth; block++) {
+            updateOccupancy(vertex, block);
+        }
+    }
+
+    // Allocates an aligned buffer of the given number of cells, filled with noEdgeValue.
+    WeightType* allocateCells(std::size_t cells) const {
+        WeightType* buffer = static_cast<WeightType*>(::operator new[](cells * sizeof(WeightType), std::align_val_t(BlockBytes)));
+        std::uninitialized_fill(buffer, buffer + cells, noEdgeValue);
+        return buffer;
+    }
+
+    // Releases a buffer obtained from allocateCells.
+    static void release(WeightType* buffer) {
+        if (buffer != nullptr) {
+            ::operator delete[](buffer, std::align_val_t(BlockBytes));
+        }
+    }
+
+    // Replaces the storage with an empty matrix of the given capacity; existing cells are discarded.
+    void allocate(int newCapacity) {
+        release(matrix);
+        capacity = newCapacity;
+        stride = (newCapacity + BlockWidth - 1) / BlockWidth * BlockWidth;
+        matrix = allocateCells(static_cast<std::size_t>(stride) * capacity);
+        occupancyWords = (stride / BlockWidth + 63) / 64;
+        occupancy.assign(trackOccupancy ? static_cast<std::size_t>(occupancyWords) * capacity : 0, 0);
+        vertices.reserve(capacity);
+    }
+
+    // Exchanges the contents of two graphs.
+    void swap(GraphAdjacencyMatrix& other) {
+        std::swap(matrix, other.matrix);
+        std::swap(stride, other.stride);
+        std::swap(occupancy, other.occupancy);
+        std::swap(occupancyWords, other.occupancyWords);
+        std::swap(trackOccupancy, other.trackOccupancy);
+        std::swap(vertices, other.vertices);
+        std::swap(removed, other.removed);
+        std::swap(freeSlots, other.freeSlots);
+        std::swap(capacity, other.capacity);
+        std::swap(numVertices, other.numVertices);
+        std::swap(numEdges, other.numEdges);
+        std::swap(noEdgeValue, other.noEdgeValue);
+        std::swap(contentVersion, other.contentVersion);
+    }
+
+    // Resizes the graph's data structures to accommodate more vertices.
+    // Capacity doubles, so the O(capacity^2) copy is amortized over the vertices added since the last resize, and the
+    // whole matrix moves in a single allocation with one contiguous copy per row.
+    void resize() {
+        int newCapacity = capacity * 2; // Double the current capacity.
+        int newStride = (newCapacity + BlockWidth - 1) / BlockWidth * BlockWidth;
+        WeightType* newMatrix = allocateCells(static_cast<std::size_t>(newStride) * newCapacity);
+        for (int i = 0; i < numVertices; i++) {
+            std::copy(rowOf(i), rowOf(i) + numVertices, newMatrix + static_cast<std::size_t>(i) * newStride);
+        }
 
-        // Clean up old data structures.
-        for (int i = 0; i < capacity; i++) {
-            delete[] matrix[i];
+        // Move the occupancy bits over; blocks keep their indices, only the row width grows.
+        int newOccupancyWords = (newStride / BlockWidth + 63) / 64;
+        std::vector<std::uint64_t> newOccupancy(trackOccupancy ? static_cast<std::size_t>(newOccupancyWords) * newCapacity : 0, 0);
+        if (trackOccupancy) {
+            for (int i = 0; i < numVertices; i++) {
+                std::copy(occupancyRow(i), occupancyRow(i) + occupancyWords, newOccupancy.begin() + static_cast<std::size_t>(i) * newOccupancyWords);
+            }
         }
-        delete[] matrix;
-        delete[] vertices;
 
         // Assign new data structures.
-        vertices = newVertices;
+        release(matrix);
         matrix = newMatrix;
+        stride = newStride;
+        occupancy = std::move(newOccupancy);
+        occupancyWords = newOccupancyWords;
         capacity = newCapacity;
+        vertices.reserve(capacity);
     }
 };
 
@@ -1,86 +1,309 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef GRAPHALGORITHM_H
-#define GRAPHADJACENCYLIST_H
+#define GRAPHALGORITHM_H
 
 #include "Graph.h"
-#include "SinglyLinkedList.h"
 #include "MinHeap.h"
+#include "IndexedDaryHeap.h"
+#include "DialBucketQueue.h"
+#include "RadixHeap.h"
+#include "SearchStats.h"
 #include <vector>
+#include <iostream>
 #include <limits>
 #include <functional>
 #include <random>
 #include <cmath>
+#include <iomanip>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
 
 // Define the namespace for housing graph-related algorithms.
 namespace GraphAlgorithm {
+    // Trait detecting graph types that expose a contiguous edges(vertex) range, such as GraphCSR.
+    template <typename GraphType, typename = void>
+    struct HasEdgeRange : std::false_type {};
+
+    template <typename GraphType>
+    struct HasEdgeRange<GraphType, std::void_t<decltype(std::declval<const GraphType&>().edges(0))>> : std::true_type {};
+
+    // Returns an iterable over the (neighbor index, weight) pairs of a vertex.
+    // Graphs with an edges() range are walked in place with no copy and no virtual call;
+    // any other graph falls back to the virtual getNeighbors(), which materializes a vector.
+    template <typename GraphType>
+    auto neighborsOf(const GraphType& graph, int vertex) {
+        if constexpr (HasEdgeRange<GraphType>::value) {
+            return graph.edges(vertex);
+        } else {
+            return graph.getNeighbors(vertex);
+        }
+    }
+
     // Define a namespace for Single-Source Shortest Path algorithms.
     namespace SSSP {
 
-        // Class implementing Dijkstra's algorithm using template parameters for vertex and weight types.
-        template <typename VertexType, typename WeightType>
-        class Dijkstra {
+        // Priority queue policies used by the SSSP algorithms. Each policy provides:
+        //   reset(numVertices)   empty the queue and accept vertex ids in [0, numVertices)
+        //   push(vertex, key)    insert the vertex, or lower its key if it is already queued
+        //   extractMin()         remove and return the (key, vertex) pair with the smallest key
+        //   isEmpty(), size()
+        // IndexedDaryHeap, DialBucketQueue and RadixHeap satisfy this interface directly.
+
+        // Queue policy wrapping the original MinHeap. It has no decrease-key, so push() inserts a duplicate
+        // entry and the caller must skip stale pops of already-settled vertices; the heap can grow to O(E).
+        template <typename WeightType>
+        class LazyMinHeapQueue {
+        private:
+            MinHeap<std::pair<WeightType, int>> heap; // Heap of (key, vertex) pairs, possibly with duplicates.
+
         public:
-            // Executes Dijkstra's algorithm from a source vertex to a destination vertex.
-            // Returns the shortest path as a singly linked list of vertex indices.
-            static SinglyLinkedList<int> execute(const Graph<VertexType, WeightType>& graph, int source, int destination) {
-                // Number of vertices in the graph.
-                int numVertices = graph.vertexCount();
-                // Distance vector, initialized to infinity.
-                std::vector<WeightType> distances(numVertices, std::numeric_limits<WeightType>::max());
-                // Previous vertex array for path reconstruction.
-                std::vector<int> previous(numVertices, -1);
-                // Visited vertices tracker.
-                std::vector<bool> visited(numVertices, false);
-                // Priority queue (min-heap) to select the vertex with the smallest distance.
-                MinHeap<std::pair<WeightType, int>> minHeap;
-
-                // Initialize the source vertex distance to zero and push it into the heap.
-                distances[source] = 0;
-                minHeap.insert({0, source});
+            void reset(int) { heap.clear(); }
+            void push(int vertex, WeightType key) { heap.insert({key, vertex}); }
+            std::pair<WeightType, int> extractMin() { return heap.extractMin(); }
+            bool isEmpty() const { return heap.isEmpty(); }
+            int size() const { return heap.size(); }
+        };
 
-                // Continue processing while there are vertices left in the priority queue.
-                while (!minHeap.isEmpty()) {
-                    // Extract the vertex with the minimum distance from the source.
-                    auto [minWeight, u] = minHeap.extractMin();
+        // Selects the default queue policy for a weight type at compile time.
+        // Floating-point weights use an indexed 4-ary heap. Integral weights use a monotone integer queue:
+        // Dial's buckets when the type is at most 16 bits wide (so the largest possible edge weight bounds the
+        // bucket window), and a radix heap for wider types.
+        template <typename WeightType, bool IsInteger = std::numeric_limits<WeightType>::is_integer>
+        struct DefaultQueue {
+            using type = IndexedDaryHeap<WeightType, 4>;
+        };
 
-                    // Skip this vertex if it has already been visited.
-                    if (visited[u]) {
-                        continue;
+        template <typename WeightType>
+        struct DefaultQueue<WeightType, true> {
+            using type = typename std::conditional<(std::numeric_limits<WeightType>::digits <= 16),
+                                                   DialBucketQueue<WeightType>, RadixHeap<WeightType>>::type;
+        };
+
+        // Reusable per-query search state for Dijkstra-style algorithms.
+        // Callers keep one workspace per thread and pass it to every query. Each vertex's state carries the
+        // generation in which it was last written; a state from an older generation reads as "unreached", so starting
+        // a new query is O(1) instead of refilling O(V) arrays. The queue is reset in proportion to its leftover
+        // entries, and all buffers keep their capacity, so steady-state queries perform no allocations.
+        // StatsType is the statistics sink the searches report to (see SearchStats.h); it accumulates across queries.
+        template <typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type, typename StatsType = NoStats>
+        class DijkstraWorkspace {
+        private:
+            // Search state of one vertex, packed together so a relaxation touches a single cache line.
+            struct VertexState {
+                WeightType distance;     // Tentative distance from the source.
+                int previous;            // Predecessor on the tentative shortest path, or -1.
+                unsigned int generation; // Query generation in which this state was last written.
+                bool settled;            // Whether the vertex's distance is final.
+            };
+
+            std::vector<VertexState> states; // Per-vertex state, valid only where generation matches.
+            unsigned int generation;         // Generation of the current query.
+            int numSettled;                  // Vertices settled in the current query.
+            QueueType queue;                 // Priority queue reused across queries.
+            StatsType statistics;            // Statistics of every query run with this workspace.
+
+            // Returns the state of a vertex, first resetting it if it was last written by an older query.
+            VertexState& touch(int vertex) {
+                VertexState& state = states[vertex];
+                if (state.generation != generation) {
+                    state = {std::numeric_limits<WeightType>::max(), -1, generation, false};
+                }
+                return state;
+            }
+
+        public:
+            // Constructor initializes an empty workspace; buffers grow on the first query over a graph.
+            DijkstraWorkspace() : generation(0), numSettled(0) {}
+
+            // Starts a new query over a graph with the given number of vertices.
+            void beginQuery(int numVertices) {
+                if (static_cast<int>(states.size()) < numVertices) {
+                    states.resize(numVertices, VertexState{std::numeric_limits<WeightType>::max(), -1, 0, false});
+                }
+                // On the rare wrap-around of the counter, stale stamps could alias the new generation; clear them once.
+                if (++generation == 0) {
+                    for (auto& state : states) {
+                        state.generation = 0;
                     }
+                    generation = 1;
+                }
+                numSettled = 0;
+                queue.reset(numVertices);
+            }
 
-                    // Mark this vertex as visited.
-                    visited[u] = true;
-                    // Break out of the loop if the destination vertex is reached.
-                    if (u == destination) break;
+            // Returns the tentative distance of a vertex, or the maximum WeightType if it has not been reached.
+            WeightType distance(int vertex) const {
+                const VertexState& state = states[vertex];
+                return state.generation == generation ? state.distance : std::numeric_limits<WeightType>::max();
+            }
 
-                    // Relaxation process: Update the distances to the adjacent vertices.
-                    auto neighbors = graph.getNeighbors(u);
-                    for (const auto& neighbor : neighbors) {
-                        int v = neighbor.first;
-                        WeightType weight = neighbor.second;
+            // Returns the predecessor of a vertex on its tentative shortest path, or -1.
+            int previous(int vertex) const {
+                const VertexState& state = states[vertex];
+                return state.generation == generation ? state.previous : -1;
+            }
 
-                        // If the vertex has not been visited and a shorter path is found, update it.
-                        if (!visited[v] && distances[u] + weight < distances[v]) {
-                            distances[v] = distances[u] + weight;
-                            previous[v] = u;
-                            minHeap.insert({distances[v], v});
-                        }
+            // Checks if a vertex's distance has been finalized in the current query.
+            bool isSettled(int vertex) const {
+                const VertexState& state = states[vertex];
+                return state.generation == generation && state.settled;
+            }
+
+            // Records a new tentative distance and predecessor for a vertex.
+            void update(int vertex, WeightType distance, int previous) {
+                VertexState& state = touch(vertex);
+                state.distance = distance;
+                state.previous = previous;
+            }
+
+            // Marks a vertex's distance as final.
+            void settle(int vertex) {
+                VertexState& state = touch(vertex);
+                if (!state.settled) {
+                    state.settled = true;
+                    ++numSettled;
+                }
+            }
+
+            // Returns the number of vertices settled in the current query.
+            int settledCount() const {
+                return numSettled;
+            }
+
+            // Appends the tentative shortest path ending at a vertex to out, in order from the search's start vertex.
+            // The hops are counted first, so the path is written back-to-front into its final slots without reversing.
+            void appendPath(int vertex, std::vector<int>& out) const {
+                std::size_t length = 0;
+                for (int at = vertex; at != -1; at = previous(at)) {
+                    ++length;
+                }
+                std::size_t slot = out.size() + length;
+                out.resize(slot);
+                for (int at = vertex; at != -1; at = previous(at)) {
+                    out[--slot] = at;
+                }
+            }
+
+            // Returns the priority queue used by the current query.
+            QueueType& frontier() {
+                return queue;
+            }
+
+            // Returns the statistics sink of this workspace.
+            StatsType& stats() {
+                return statistics;
+            }
+
+            // Returns the statistics sink of this workspace.
+            const StatsType& stats() const {
+                return statistics;
+            }
+        };
+
+        // Point-to-point result: the vertices of a shortest path and its total weight.
+        // An unreachable destination gives an empty path, the maximum WeightType as weight and reachable set to false.
+        template <typename WeightType>
+        struct ShortestPath {
+            std::vector<int> vertices; // Vertex indices from the source to the destination.
+            WeightType totalWeight;    // Sum of the edge weights along the path.
+            bool reachable;            // Whether any path from the source to the destination exists.
+
+            ShortestPath() : totalWeight(std::numeric_limits<WeightType>::max()), reachable(false) {}
+
+            // Prints the path as "a -> b -> c".
+            void print() const {
+                for (std::size_t i = 0; i < vertices.size(); ++i) {
+                    if (i != 0) {
+                        std::cout << " -> ";
                     }
+                    std::cout << vertices[i];
+                }
+                std::cout << std::endl;
+            }
+        };
+
+        // Full single-source result: the shortest distance and predecessor of every vertex.
+        template <typename WeightType>
+        struct ShortestPathTree {
+            std::vector<WeightType> distances; // Distance from the source, or the maximum WeightType if unreachable.
+            std::vector<int> previous;         // Predecessor on a shortest path, or -1 for the source and unreachable vertices.
+        };
+
+        // Array-scan Dijkstra for dense graphs, defined in DenseDijkstra.h.
+        template <typename VertexType, typename WeightType>
+        class DenseDijkstra;
+
+        // Class implementing Dijkstra's algorithm using template parameters for vertex and weight types.
+        // QueueType selects the priority queue policy; see DefaultQueue for how the default is chosen.
+        // Without a workspace, execute and shortestPathTree hand graphs dense enough for DenseDijkstra::isPreferred
+        // to DenseDijkstra, which needs no queue at all.
+        // StatsType selects the statistics sink: NoStats compiles the instrumentation away, SearchStats records queue
+        // and relaxation counts and phase times in the workspace, where they can be read after each query.
+        template <typename VertexType, typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type,
+                  typename StatsType = NoStats>
+        class Dijkstra {
+        public:
+            // Search state type that callers can keep between queries to avoid per-query allocation and O(V) setup.
+            using Workspace = DijkstraWorkspace<WeightType, QueueType, StatsType>;
+
+            // Executes Dijkstra's algorithm from a source vertex to a destination vertex.
+            // Returns the shortest path with its total weight, read directly from the search's distances.
+            // GraphType may be any Graph; passing a GraphCSR directly lets neighbors be read without copies.
+            template <typename GraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination) {
+                if (DenseDijkstra<VertexType, WeightType>::isPreferred(graph)) {
+                    return DenseDijkstra<VertexType, WeightType>::execute(graph, source, destination);
                 }
+                Workspace workspace;
+                return execute(graph, source, destination, workspace);
+            }
+
+            // Executes Dijkstra's algorithm reusing the caller's workspace.
+            // The work done is proportional to the vertices the search touches, not to the size of the graph.
+            // After the call, the workspace also holds the distances of all settled vertices.
+            template <typename GraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination, Workspace& workspace) {
+                search(graph, source, destination, workspace);
+                // Reconstruct and return the shortest path using the recorded predecessors.
+                workspace.stats().beginPath();
+                ShortestPath<WeightType> path = buildPath(workspace, destination);
+                workspace.stats().endPath();
+                return path;
+            }
 
-                // Reconstruct and return the shortest path using the previous array.
-                return buildPath(previous, destination);
+            // Computes the full shortest-path tree from a source: the distance and predecessor of every vertex.
+            // Unreachable vertices keep the maximum WeightType as distance and -1 as predecessor.
+            template <typename GraphType>
+            static ShortestPathTree<WeightType> shortestPathTree(const GraphType& graph, int source) {
+                if (DenseDijkstra<VertexType, WeightType>::isPreferred(graph)) {
+                    return DenseDijkstra<VertexType, WeightType>::shortestPathTree(graph, source);
+                }
+                Workspace workspace;
+                search(graph, source, -1, workspace);
+                int numVertices = graph.vertexCount();
+                ShortestPathTree<WeightType> tree;
+                tree.distances.resize(numVertices);
+                tree.previous.resize(numVertices);
+                for (int v = 0; v < numVertices; ++v) {
+                    tree.distances[v] = workspace.distance(v);
+                    tree.previous[v] = workspace.previous(v);
+                }
+                return tree;
             }
 
             // Generates a graph with a specified number of vertices and randomly placed edges.
+            // Passing a seed makes the graph reproducible; GraphGenerator builds large graphs much faster.
             template <typename GraphType>
-            static void createRandomGraph(GraphType& graph, int numVertices, int maxEdges, WeightType minWeight, WeightType maxWeight) {
-                std::random_device rd;  // Random number generator.
-                std::mt19937 gen(rd());  // Generator seeded with rd.
+            static void createRandomGraph(GraphType& graph, int numVertices, int maxEdges, WeightType minWeight, WeightType maxWeight,
+                                          unsigned int seed = std::random_device()()) {
+                std::mt19937 gen(seed);  // Generator seeded with the given or a nondeterministic seed.
                 std::uniform_int_distribution<> vertexDist(0, numVertices - 1);
-                std::uniform_real_distribution<WeightType> weightDist(minWeight, maxWeight);
+                // Integral weights are drawn uniformly from the integers in [minWeight, maxWeight].
+                typename std::conditional<std::is_integral<WeightType>::value, std::uniform_int_distribution<WeightType>,
+                                          std::uniform_real_distribution<WeightType>>::type weightDist(minWeight, maxWeight);
 
                 // Add the specified number of vertices to the graph.
                 for (int i = 0; i < numVertices; ++i) {
@@ -100,12 +323,10 @@ namespace GraphAlgorithm {
             }
 
             // Displays the shortest path and total path weight from the source to the destination.
-            template <typename GraphType>
-            static void printSSSP(GraphType& graph, int source, int destination, SinglyLinkedList<int>& path) {
+            static void printSSSP(int source, int destination, const ShortestPath<WeightType>& path) {
                 std::cout << "Source: " << source << " to Destination: " << destination << std::endl;
 
-                // If the destination is directly the head of the path, no path was found.
-                if (path.head->data == destination) {
+                if (!path.reachable) {
                     std::cout << "No path exists from " << source << " to " << destination << std::endl;
                     return;
                 }
@@ -113,45 +334,328 @@ namespace GraphAlgorithm {
                 std::cout << "Shortest path from vertex " << source << " to vertex " << destination << ": ";
                 path.print();
                 // Calculate and display the total path weight rounded to one decimal place.
-                std::cout << "Total Path Weight: " << std::fixed << std::setprecision(1) << round(getTotalWeight(graph, path) * 10) / 10 << std::endl;
+                std::cout << "Total Path Weight: " << std::fixed << std::setprecision(1) << round(path.totalWeight * 10) / 10 << std::endl;
             }
 
         private:
-            // Reconstructs the shortest path from the source to the destination using the previous vertices array.
-            static SinglyLinkedList<int> buildPath(const std::vector<int>& previous, int destination) {
-                SinglyLinkedList<int> path;
-                for (int at = destination; at != -1; at = previous[at]) {
-                    path.append(at);
+            // Runs Dijkstra's algorithm from the source, stopping once the destination is settled.
+            // A destination of -1 never matches, so the search settles every reachable vertex.
+            template <typename GraphType>
+            static void search(const GraphType& graph, int source, int destination, Workspace& workspace) {
+                workspace.beginQuery(graph.vertexCount());
+                StatsType& stats = workspace.stats();
+                stats.beginQuery();
+                // Priority queue to select the vertex with the smallest distance.
+                QueueType& queue = workspace.frontier();
+
+                // Initialize the source vertex distance to zero and push it into the queue.
+                workspace.update(source, 0, -1);
+                queue.push(source, 0);
+                stats.pushed(queue.size());
+
+                // Continue processing while there are vertices left in the priority queue.
+                while (!queue.isEmpty()) {
+                    // Extract the vertex with the minimum distance from the source.
+                    auto [minWeight, u] = queue.extractMin();
+                    stats.popped();
+
+                    // Skip this vertex if it has already been visited (only lazy queues produce such stale entries).
+                    if (workspace.isSettled(u)) {
+                        stats.stalePopped();
+                        continue;
+                    }
+
+                    // Mark this vertex as visited.
+                    workspace.settle(u);
+                    stats.settled();
+                    // Break out of the loop if the destination vertex is reached.
+                    if (u == destination) break;
+
+                    // Relaxation process: Update the distances to the adjacent vertices.
+                    stats.beginNeighbors();
+                    auto&& neighbors = neighborsOf(graph, u);
+                    stats.endNeighbors();
+                    for (const auto& neighbor : neighbors) {
+                        int v = neighbor.first;
+                        WeightType weight = neighbor.second;
+
+                        // If the vertex has not been visited and a shorter path is found, update it.
+                        WeightType candidate = minWeight + weight;
+                        bool improved = !workspace.isSettled(v) && candidate < workspace.distance(v);
+                        stats.relaxed(improved);
+                        if (improved) {
+                            workspace.update(v, candidate, u);
+                            queue.push(v, candidate);
+                            stats.pushed(queue.size());
+                        }
+                    }
+                }
+                stats.endQuery();
+            }
+
+            // Builds the point-to-point result for the destination from the recorded predecessors and distance.
+            static ShortestPath<WeightType> buildPath(const Workspace& workspace, int destination) {
+                ShortestPath<WeightType> path;
+                if (workspace.isSettled(destination)) {
+                    path.reachable = true;
+                    path.totalWeight = workspace.distance(destination);
+                    workspace.appendPath(destination, path.vertices);
+                }
+                return path;
+            }
+        };
+
+        // Class implementing bidirectional Dijkstra for point-to-point queries.
+        // A forward search from the source over the graph and a backward search from the destination over its reverse
+        // (see GraphCSR::reversed) settle vertices in alternation. Every relaxation that reaches a vertex already seen by
+        // the other side offers a candidate path; the search stops once the two search radii together reach the best
+        // candidate, which is then provably shortest. Each side only explores roughly half the radius of a one-sided search.
+        template <typename VertexType, typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type>
+        class BidirectionalDijkstra {
+        public:
+            // Search state for both directions, reusable across queries like Dijkstra's workspace.
+            struct Workspace {
+                DijkstraWorkspace<WeightType, QueueType> forward;  // State of the search from the source.
+                DijkstraWorkspace<WeightType, QueueType> backward; // State of the search from the destination.
+            };
+
+            // Executes bidirectional Dijkstra from a source vertex to a destination vertex.
+            // reverseGraph must hold the same vertices as graph with every edge reversed; build it once and reuse it.
+            // Returns the shortest path in the same form as Dijkstra::execute.
+            template <typename GraphType, typename ReverseGraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, const ReverseGraphType& reverseGraph, int source, int destination) {
+                Workspace workspace;
+                return execute(graph, reverseGraph, source, destination, workspace);
+            }
+
+            // Executes bidirectional Dijkstra reusing the caller's workspace.
+            template <typename GraphType, typename ReverseGraphType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, const ReverseGraphType& reverseGraph, int source, int destination,
+                                                    Workspace& workspace) {
+                if (graph.vertexCount() != reverseGraph.vertexCount()) {
+                    throw std::invalid_argument("Reverse graph does not match the graph");
+                }
+                workspace.forward.beginQuery(graph.vertexCount());
+                workspace.backward.beginQuery(graph.vertexCount());
+                workspace.forward.update(source, 0, -1);
+                workspace.forward.frontier().push(source, 0);
+                workspace.backward.update(destination, 0, -1);
+                workspace.backward.frontier().push(destination, 0);
+
+                // Length of the best source-destination path found so far, and the vertex where its two halves meet.
+                WeightType best = std::numeric_limits<WeightType>::max();
+                int meeting = -1;
+                if (source == destination) {
+                    best = 0;
+                    meeting = source;
+                }
+                // Distance of the last vertex settled by each side; neither side can settle anything closer.
+                WeightType forwardRadius = 0;
+                WeightType backwardRadius = 0;
+
+                // Alternate single settle steps until a side runs dry or the radii prove the best path optimal.
+                while (true) {
+                    if (!step(graph, workspace.forward, workspace.backward, forwardRadius, best, meeting)) break;
+                    if (meeting != -1 && !(forwardRadius + backwardRadius < best)) break;
+                    if (!step(reverseGraph, workspace.backward, workspace.forward, backwardRadius, best, meeting)) break;
+                    if (meeting != -1 && !(forwardRadius + backwardRadius < best)) break;
+                }
+
+                return buildPath(workspace, meeting, best);
+            }
+
+        private:
+            // Settles the closest unsettled vertex of one side and relaxes its edges.
+            // Returns false if that side has nothing left to settle.
+            template <typename GraphType>
+            static bool step(const GraphType& graph, DijkstraWorkspace<WeightType, QueueType>& self,
+                             const DijkstraWorkspace<WeightType, QueueType>& other, WeightType& radius, WeightType& best, int& meeting) {
+                QueueType& queue = self.frontier();
+                int u = -1;
+                // Skip stale entries left behind by lazy queues.
+                while (!queue.isEmpty()) {
+                    auto [key, vertex] = queue.extractMin();
+                    if (!self.isSettled(vertex)) {
+                        radius = key;
+                        u = vertex;
+                        break;
+                    }
+                }
+                if (u == -1) {
+                    return false;
+                }
+                self.settle(u);
+
+                // Relaxation process: update this side's distances and look for paths through the other side.
+                for (const auto& neighbor : neighborsOf(graph, u)) {
+                    int v = neighbor.first;
+                    WeightType candidate = radius + neighbor.second;
+                    if (!self.isSettled(v) && candidate < self.distance(v)) {
+                        self.update(v, candidate, u);
+                        queue.push(v, candidate);
+                    }
+                    // A vertex reached by both sides joins the two searches into a complete path.
+                    WeightType remaining = other.distance(v);
+                    if (remaining != std::numeric_limits<WeightType>::max() && candidate + remaining < best) {
+                        best = candidate + remaining;
+                        meeting = v;
+                    }
+                }
+                return true;
+            }
+
+            // Joins the forward tree path source -> meeting with the backward tree path meeting -> destination.
+            // best is the length of the joined path; a meeting vertex of -1 means no path exists.
+            static ShortestPath<WeightType> buildPath(const Workspace& workspace, int meeting, WeightType best) {
+                ShortestPath<WeightType> path;
+                if (meeting == -1) {
+                    return path;
+                }
+                path.reachable = true;
+                path.totalWeight = best;
+                workspace.forward.appendPath(meeting, path.vertices);
+                for (int at = workspace.backward.previous(meeting); at != -1; at = workspace.backward.previous(at)) {
+                    path.vertices.push_back(at);
                 }
-                path.reverseList(); // Reverse the list to correct the order from source to destination.
                 return path;
             }
+        };
+
+        // Heuristic that always returns zero; A* with it settles vertices exactly as Dijkstra does.
+        template <typename WeightType>
+        struct ZeroHeuristic {
+            WeightType operator()(int, int) const { return 0; }
+        };
+
+        // Straight-line distance heuristic for vertex types exposing planar coordinates as members x and y.
+        // Coordinates are copied once at construction, so each evaluation is two array reads and a square root.
+        // scale converts coordinate units into weight units (for example 1 / maximum speed when weights are travel times);
+        // the heuristic stays admissible and consistent as long as no edge is cheaper than its scaled straight-line length.
+        template <typename WeightType>
+        class EuclideanHeuristic {
+        private:
+            std::vector<std::pair<double, double>> coordinates; // (x, y) of each vertex.
+            double scale;                                       // Weight units per coordinate unit.
+
+        public:
+            template <typename GraphType>
+            explicit EuclideanHeuristic(const GraphType& graph, double scale = 1.0) : scale(scale) {
+                coordinates.reserve(graph.vertexCount());
+                for (int i = 0; i < graph.vertexCount(); ++i) {
+                    auto vertex = graph.getVertex(i);
+                    coordinates.emplace_back(static_cast<double>(vertex.x), static_cast<double>(vertex.y));
+                }
+            }
+
+            WeightType operator()(int vertex, int destination) const {
+                double dx = coordinates[vertex].first - coordinates[destination].first;
+                double dy = coordinates[vertex].second - coordinates[destination].second;
+                return static_cast<WeightType>(std::sqrt(dx * dx + dy * dy) * scale);
+            }
+        };
+
+        // Great-circle distance heuristic for vertex types exposing members latitude and longitude in degrees.
+        // Distances are computed in meters on a spherical Earth and multiplied by scale to convert them into weight units.
+        template <typename WeightType>
+        class HaversineHeuristic {
+        private:
+            std::vector<std::pair<double, double>> coordinates; // (latitude, longitude) of each vertex, in radians.
+            double scale;                                       // Weight units per meter.
+
+        public:
+            // Mean Earth radius in meters.
+            static constexpr double EarthRadius = 6371008.8;
 
-            // Calculates the total weight of the path from the source to the destination.
             template <typename GraphType>
-            static WeightType getTotalWeight(const GraphType& graph, const SinglyLinkedList<int>& path) {
-                if (path.head == nullptr) {
-                    throw std::invalid_argument("Path cannot be empty to calculate weight.");
+            explicit HaversineHeuristic(const GraphType& graph, double scale = 1.0) : scale(scale) {
+                const double toRadians = std::acos(-1.0) / 180.0;
+                coordinates.reserve(graph.vertexCount());
+                for (int i = 0; i < graph.vertexCount(); ++i) {
+                    auto vertex = graph.getVertex(i);
+                    coordinates.emplace_back(static_cast<double>(vertex.latitude) * toRadians, static_cast<double>(vertex.longitude) * toRadians);
                 }
+            }
+
+            WeightType operator()(int vertex, int destination) const {
+                double lat1 = coordinates[vertex].first;
+                double lat2 = coordinates[destination].first;
+                double sinLat = std::sin((lat2 - lat1) / 2);
+                double sinLon = std::sin((coordinates[destination].second - coordinates[vertex].second) / 2);
+                double a = sinLat * sinLat + std::cos(lat1) * std::cos(lat2) * sinLon * sinLon;
+                double meters = 2 * EarthRadius * std::asin(std::sqrt(std::min(1.0, a)));
+                return static_cast<WeightType>(meters * scale);
+            }
+        };
+
+        // Class implementing A* search, Dijkstra's algorithm steered towards the destination by a heuristic.
+        // The heuristic is any callable h(vertexIndex, destination) returning a lower bound on the remaining distance.
+        // It must also be consistent (h(u) <= w(u, v) + h(v)) so that settled vertices never need reopening; the
+        // built-in heuristics are consistent when scaled as documented. Queue keys are g + h, so the monotone integer
+        // queues remain valid with consistent integral heuristics.
+        // execute mirrors Dijkstra::execute, so the two can be swapped per query.
+        template <typename VertexType, typename WeightType, typename QueueType = typename DefaultQueue<WeightType>::type>
+        class AStar {
+        public:
+            // Search state type, shared with Dijkstra.
+            using Workspace = DijkstraWorkspace<WeightType, QueueType>;
+
+            // Executes A* from a source vertex to a destination vertex.
+            // Returns the shortest path in the same form as Dijkstra::execute.
+            template <typename GraphType, typename HeuristicType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination, const HeuristicType& heuristic) {
+                Workspace workspace;
+                return execute(graph, source, destination, heuristic, workspace);
+            }
+
+            // Executes A* reusing the caller's workspace.
+            // The workspace's distances hold exact path lengths (without the heuristic) for settled vertices.
+            template <typename GraphType, typename HeuristicType>
+            static ShortestPath<WeightType> execute(const GraphType& graph, int source, int destination, const HeuristicType& heuristic,
+                                                    Workspace& workspace) {
+                workspace.beginQuery(graph.vertexCount());
+                QueueType& queue = workspace.frontier();
+
+                workspace.update(source, 0, -1);
+                queue.push(source, heuristic(source, destination));
 
-                WeightType totalWeight = 0;
-                SinglyLinkedList<int>::Node *cur = path.head;
-                int from = cur->data;
-                SinglyLinkedList<int>::Node *tail = path.tail;
+                while (!queue.isEmpty()) {
+                    // Extract the vertex with the smallest estimated total path length.
+                    int u = queue.extractMin().second;
 
-                // Iterate through the path and sum up the weights of the edges.
-                while (cur != tail) {
-                    cur = cur->next;
-                    int to = cur->data;
-                    totalWeight += graph.getEdgeWeight(from, to);
-                    from = to;
+                    // Skip this vertex if it has already been visited (only lazy queues produce such stale entries).
+                    if (workspace.isSettled(u)) {
+                        continue;
+                    }
+
+                    workspace.settle(u);
+                    if (u == destination) break;
+
+                    // Relaxation process: identical to Dijkstra, except that vertices are queued by g + h.
+                    WeightType distance = workspace.distance(u);
+                    for (const auto& neighbor : neighborsOf(graph, u)) {
+                        int v = neighbor.first;
+                        WeightType candidate = distance + neighbor.second;
+                        if (!workspace.isSettled(v) && candidate < workspace.distance(v)) {
+                            workspace.update(v, candidate, u);
+                            queue.push(v, candidate + heuristic(v, destination));
+                        }
+                    }
                 }
 
-                return totalWeight;
+                // Reconstruct the path from the predecessors; the same form as Dijkstra, including the unreachable case.
+                ShortestPath<WeightType> path;
+                if (workspace.isSettled(destination)) {
+                    path.reachable = true;
+                    path.totalWeight = workspace.distance(destination);
+                    workspace.appendPath(destination, path.vertices);
+                }
+                return path;
             }
         };
 
     } // namespace SSSP
 } // namespace GraphAlgorithm
 
+#include "DenseDijkstra.h"
+
 #endif // GRAPHALGORITHM_H
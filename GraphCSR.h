@@ -0,0 +1,255 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef GRAPHCSR_H
+#define GRAPHCSR_H
+
+#include "Graph.h"
+#include "WeightEncoding.h"
+#include <vector>
+#include <limits>
+#include <stdexcept>
+#include <iomanip>
+#include <cmath>
+#include <utility>
+
+// Template class for GraphCSR, an immutable graph stored in compressed sparse row (CSR) form.
+// The outgoing edges of vertex v occupy the half-open range [offsets[v], offsets[v + 1]) of the contiguous
+// targets and weights arrays, so walking a vertex's neighbors reads sequential memory and allocates nothing.
+// A GraphCSR is normally frozen from a mutable GraphAdjacencyList or GraphAdjacencyMatrix once it is fully built.
+// IndexType is the integer type each edge's target is stored as, and WeightEncoding how each weight is stored (see
+// WeightEncoding.h). The defaults take 4 bytes per target plus a full WeightType. For graphs that fit, std::uint16_t
+// targets with FixedPointWeights<WeightType> take 4 bytes per edge in all, so far more of a large graph stays in cache;
+// searches still see int indices and decoded WeightType weights.
+template <typename VertexType, typename WeightType, typename IndexType = int, typename WeightEncoding = PlainWeights<WeightType>>
+class GraphCSR final : public Graph<VertexType, WeightType> {
+public:
+    using StoredWeight = typename WeightEncoding::StorageType;
+
+    // Non-owning view over the outgoing edges of a single vertex.
+    // Iterating it yields (neighbor index, weight) pairs by value, matching the element type of getNeighbors().
+    class EdgeRange {
+    public:
+        // Forward iterator that walks the parallel targets and weights arrays in lockstep, decoding as it goes.
+        class Iterator {
+        public:
+            Iterator(const IndexType* target, const StoredWeight* weight, WeightEncoding encoding)
+                : target(target), weight(weight), encoding(encoding) {}
+
+            std::pair<int, WeightType> operator*() const { return {static_cast<int>(*target), encoding.decode(*weight)}; }
+            Iterator& operator++() { ++target; ++weight; return *this; }
+            bool operator==(const Iterator& other) const { return target == other.target; }
+            bool operator!=(const Iterator& other) const { return target != other.target; }
+
+        private:
+            const IndexType* target;     // Current position in the targets array.
+            const StoredWeight* weight;  // Current position in the weights array.
+            WeightEncoding encoding;     // Decoder of the stored weights.
+        };
+
+        EdgeRange(const IndexType* targets, const StoredWeight* weights, int count, WeightEncoding encoding = WeightEncoding())
+            : targets(targets), weights(weights), count(count), encoding(encoding) {}
+
+        Iterator begin() const { return Iterator(targets, weights, encoding); }
+        Iterator end() const { return Iterator(targets + count, weights + count, encoding); }
+
+        // Returns the number of edges in the range.
+        int size() const { return count; }
+        // Checks if the range holds no edges.
+        bool empty() const { return count == 0; }
+        // Returns the target vertex index of the i-th edge.
+        int target(int i) const { return static_cast<int>(targets[i]); }
+        // Returns the weight of the i-th edge.
+        WeightType weight(int i) const { return encoding.decode(weights[i]); }
+
+    private:
+        const IndexType* targets;    // First target index of the vertex's edges.
+        const StoredWeight* weights; // First weight of the vertex's edges.
+        int count;                   // Number of edges in the range.
+        WeightEncoding encoding;     // Decoder of the stored weights.
+    };
+
+    // Freezes any graph (typically a GraphAdjacencyList or GraphAdjacencyMatrix) into CSR form.
+    // Edges keep the order in which the source graph reports them through getNeighbors().
+    // The encoding is fitted to the graph's weights, for example to pick a fixed-point scale.
+    explicit GraphCSR(const Graph<VertexType, WeightType>& graph, WeightEncoding encoding = WeightEncoding()) : encoding(encoding) {
+        int numVertices = graph.vertexCount();
+        checkIndexRange(numVertices);
+        std::vector<WeightType> plainWeights;
+        vertices.reserve(numVertices);
+        offsets.reserve(numVertices + 1);
+        offsets.push_back(0);
+        for (int v = 0; v < numVertices; ++v) {
+            vertices.push_back(graph.getVertex(v));
+            for (const auto& edge : graph.getNeighbors(v)) {
+                targets.push_back(static_cast<IndexType>(edge.first));
+                plainWeights.push_back(edge.second);
+            }
+            offsets.push_back(static_cast<int>(targets.size())); // Close the edge range of vertex v.
+        }
+        weights = this->encoding.encode(std::move(plainWeights));
+    }
+
+    // Builds a graph directly from prepared CSR arrays, taking ownership of them.
+    // offsets must hold vertices.size() + 1 non-decreasing entries starting at 0 and ending at targets.size().
+    GraphCSR(std::vector<VertexType> vertices, std::vector<int> offsets, std::vector<IndexType> targets, std::vector<WeightType> weights,
+             WeightEncoding encoding = WeightEncoding())
+        : vertices(std::move(vertices)), offsets(std::move(offsets)), targets(std::move(targets)), encoding(encoding) {
+        int numVertices = static_cast<int>(this->vertices.size());
+        if (this->offsets.size() != this->vertices.size() + 1 || this->offsets.front() != 0 ||
+            this->offsets.back() != static_cast<int>(this->targets.size()) || this->targets.size() != weights.size()) {
+            throw std::invalid_argument("Inconsistent CSR array sizes");
+        }
+        checkIndexRange(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            if (this->offsets[v] > this->offsets[v + 1]) {
+                throw std::invalid_argument("CSR offsets must be non-decreasing");
+            }
+        }
+        for (IndexType target : this->targets) {
+            if (static_cast<long long>(target) < 0 || static_cast<long long>(target) >= numVertices) {
+                throw std::out_of_range("Edge target out of range");
+            }
+        }
+        this->weights = this->encoding.encode(std::move(weights));
+    }
+
+    // Destructor is trivial as the STL containers handle their own memory management.
+    virtual ~GraphCSR() {}
+
+    // Builds the reverse (transpose) of a graph in CSR form: every edge u -> v becomes v -> u with the same weight.
+    // Backward searches walk this view to follow edges against their direction.
+    static GraphCSR reversed(const Graph<VertexType, WeightType>& graph, WeightEncoding encoding = WeightEncoding()) {
+        int numVertices = graph.vertexCount();
+        std::vector<VertexType> vertices;
+        vertices.reserve(numVertices);
+        // Counting pass: in-degree of every vertex, shifted by one so a prefix sum yields the offsets.
+        std::vector<int> offsets(numVertices + 1, 0);
+        for (int u = 0; u < numVertices; ++u) {
+            vertices.push_back(graph.getVertex(u));
+            for (const auto& edge : graph.getNeighbors(u)) {
+                ++offsets[edge.first + 1];
+            }
+        }
+        for (int v = 0; v < numVertices; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        // Fill pass: place each reversed edge at the next free slot of its new source.
+        std::vector<IndexType> targets(offsets[numVertices]);
+        std::vector<WeightType> weights(offsets[numVertices]);
+        std::vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : graph.getNeighbors(u)) {
+                int slot = next[edge.first]++;
+                targets[slot] = static_cast<IndexType>(u);
+                weights[slot] = edge.second;
+            }
+        }
+        return GraphCSR(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights), encoding);
+    }
+
+    // Returns a view over the outgoing edges of a vertex without copying them.
+    EdgeRange edges(int vertex) const {
+        int first = offsets[vertex];
+        return EdgeRange(targets.data() + first, weights.data() + first, offsets[vertex + 1] - first, encoding);
+    }
+
+    // Returns the number of outgoing edges of a vertex.
+    int degree(int vertex) const {
+        return offsets[vertex + 1] - offsets[vertex];
+    }
+
+    // Returns the total number of edges in the graph.
+    int edgeCount() const {
+        return static_cast<int>(targets.size());
+    }
+
+    // Returns the bytes held by the offsets, targets and weights arrays.
+    std::size_t edgeBytes() const {
+        return offsets.size() * sizeof(int) + targets.size() * sizeof(IndexType) + weights.size() * sizeof(StoredWeight);
+    }
+
+    // A GraphCSR is immutable; structural changes must be made on the source graph and re-frozen.
+    int addVertex(VertexType) override {
+        throw std::logic_error("GraphCSR is immutable");
+    }
+
+    void removeVertex(int) override {
+        throw std::logic_error("GraphCSR is immutable");
+    }
+
+    void addEdge(int, int, WeightType) override {
+        throw std::logic_error("GraphCSR is immutable");
+    }
+
+    void removeEdge(int, int) override {
+        throw std::logic_error("GraphCSR is immutable");
+    }
+
+    // Retrieves a copy of all neighbors and their edge weights for a given vertex.
+    // Prefer edges() on hot paths, which exposes the same data without allocating.
+    std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const override {
+        std::vector<std::pair<int, WeightType>> neighbors;
+        neighbors.reserve(degree(vertex));
+        for (const auto& edge : edges(vertex)) {
+            neighbors.push_back(edge);
+        }
+        return neighbors;
+    }
+
+    // Retrieves the weight of an edge between two specified vertices.
+    WeightType getEdgeWeight(int fromVertex, int toVertex) const override {
+        for (int i = offsets[fromVertex]; i < offsets[fromVertex + 1]; ++i) {
+            if (static_cast<int>(targets[i]) == toVertex) {
+                return encoding.decode(weights[i]);
+            }
+        }
+        throw std::range_error("Edge does not exist");
+    }
+
+    // Returns the vertex stored at the given index.
+    VertexType getVertex(int vertexIndex) const override {
+        if (vertexIndex < 0 || vertexIndex >= vertexCount()) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return vertices[vertexIndex];
+    }
+
+    // Returns the current number of vertices in the graph.
+    int vertexCount() const override {
+        return static_cast<int>(vertices.size());
+    }
+
+    // Prints the entire graph in adjacency list form along with vertex identifiers.
+    void print() const override {
+        std::cout << "Graph (CSR Representation):" << std::endl;
+        for (int i = 0; i < vertexCount(); ++i) {
+            std::cout << vertices[i] << " -> ";
+            for (const auto& edge : edges(i)) {
+                std::cout << "(" << vertices[edge.first] << ", " << std::fixed << std::setprecision(1) << round(edge.second * 10) / 10 << ") ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+private:
+    // Throws if some vertex index of a graph with numVertices vertices would not fit IndexType.
+    static void checkIndexRange(int numVertices) {
+        if (numVertices > 0 && static_cast<unsigned long long>(numVertices - 1) > static_cast<unsigned long long>(std::numeric_limits<IndexType>::max())) {
+            throw std::out_of_range("Vertex index does not fit the index type");
+        }
+    }
+
+    // Vertex values, indexed by vertex index.
+    std::vector<VertexType> vertices;
+    // offsets[v] is the position of vertex v's first edge; offsets[numVertices] equals the edge count.
+    std::vector<int> offsets;
+    // Target vertex index of each edge, grouped by source vertex.
+    std::vector<IndexType> targets;
+    // Encoded weight of each edge, parallel to targets.
+    std::vector<StoredWeight> weights;
+    // Encoding of the stored weights.
+    WeightEncoding encoding;
+};
+
+#endif // GRAPHCSR_H
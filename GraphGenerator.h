@@ -0,0 +1,434 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef GRAPHGENERATOR_H
+#define GRAPHGENERATOR_H
+
+#include "GraphCSR.h"
+#include "Parallel.h"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Template class GraphGenerator, which builds reproducible synthetic graphs straight into a GraphCSR.
+// Every random choice is drawn from a counter-based stream keyed by the seed and the index of the vertex or edge being
+// generated, never from a shared generator. The vertex range is split into one block per thread, but since no value
+// depends on which thread draws it, the same seed yields the same graph on any number of threads. The CSR is built
+// like GraphImporter builds it: a counting pass sizes every vertex's edge range, a prefix sum turns the degrees into
+// offsets, and a fill pass writes each edge into its reserved slot, with each vertex's edges sorted by target.
+// Vertex values are the 0-based vertex indices converted to VertexType. Integral weights are drawn uniformly from
+// [minWeight, maxWeight], floating-point weights uniformly from [minWeight, maxWeight).
+template <typename VertexType, typename WeightType>
+class GraphGenerator {
+public:
+    // Builds a rows x cols grid, road-network-like in its low degree and large diameter. Vertex r * cols + c is linked in
+    // both directions to its horizontal and vertical neighbours, and every directed edge gets its own random weight.
+    static GraphCSR<VertexType, WeightType> grid(int rows, int cols, WeightType minWeight, WeightType maxWeight,
+                                                 std::uint64_t seed, int numThreads = 0) {
+        if (rows < 1 || cols < 1 || static_cast<long long>(rows) * cols > std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("Grid dimensions out of range");
+        }
+        checkWeights(minWeight, maxWeight);
+        numThreads = resolveThreadCount(numThreads);
+        int numVertices = rows * cols;
+
+        std::vector<int> offsets(numVertices + 1);
+        offsets[0] = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            int row = v / cols;
+            int col = v % cols;
+            offsets[v + 1] = offsets[v] + (row > 0) + (col > 0) + (col + 1 < cols) + (row + 1 < rows);
+        }
+        std::vector<int> targets(offsets[numVertices]);
+        std::vector<WeightType> weights(offsets[numVertices]);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            for (int v = first; v < last; ++v) {
+                int row = v / cols;
+                int col = v % cols;
+                int slot = offsets[v];
+                // Neighbours in increasing index order: up, left, right, down. Each direction has its own stream.
+                const int steps[4] = {-cols, -1, 1, cols};
+                const bool present[4] = {row > 0, col > 0, col + 1 < cols, row + 1 < rows};
+                for (int direction = 0; direction < 4; ++direction) {
+                    if (present[direction]) {
+                        Stream stream(seed, static_cast<std::uint64_t>(v) * 4 + direction);
+                        targets[slot] = v + steps[direction];
+                        weights[slot] = stream.weight(minWeight, maxWeight);
+                        ++slot;
+                    }
+                }
+            }
+        });
+        return build(numVertices, std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+    // Builds a recursive-matrix (R-MAT) graph with 2^scale vertices, whose degrees follow a power law.
+    // Each of numEdges edges picks its cell of the adjacency matrix by descending scale levels, choosing the top-left,
+    // top-right, bottom-left or bottom-right quadrant with probabilities a, b, c and 1 - a - b - c. Vertex ids are then
+    // scrambled by a seeded bijection so the hubs are spread over the id range rather than clustered at 0, as in Graph500.
+    // Self-loops are dropped and parallel edges merged into the lightest one, so the result has somewhat fewer than
+    // numEdges edges. a = b = c = 0.25 gives a uniform random graph.
+    static GraphCSR<VertexType, WeightType> rmat(int scale, long long numEdges, WeightType minWeight, WeightType maxWeight,
+                                                 std::uint64_t seed, int numThreads = 0, double a = 0.57, double b = 0.19, double c = 0.19) {
+        if (scale < 1 || scale > 30) {
+            throw std::invalid_argument("R-MAT scale must be between 1 and 30");
+        }
+        if (numEdges < 0 || numEdges > std::numeric_limits<int>::max()) {
+            throw std::invalid_argument("Edge count out of range");
+        }
+        if (a < 0 || b < 0 || c < 0 || a + b + c > 1) {
+            throw std::invalid_argument("R-MAT probabilities must be non-negative and sum to at most 1");
+        }
+        checkWeights(minWeight, maxWeight);
+        numThreads = resolveThreadCount(numThreads);
+        int numVertices = 1 << scale;
+        Scrambler scrambler(scale, seed);
+
+        // Quadrant thresholds as 32-bit fixed-point fractions, so each level costs half a 64-bit draw and no branches.
+        const double unit = 4294967296.0;
+        const std::uint64_t thresholdA = static_cast<std::uint64_t>(a * unit);
+        const std::uint64_t thresholdAB = static_cast<std::uint64_t>((a + b) * unit);
+        const std::uint64_t thresholdABC = static_cast<std::uint64_t>((a + b + c) * unit);
+
+        // Returns the endpoints of edge i, or false for a self-loop.
+        auto endpoints = [&](long long i, int& from, int& to, Stream& stream) {
+            stream = Stream(seed, static_cast<std::uint64_t>(i));
+            from = 0;
+            to = 0;
+            std::uint64_t bits = 0;
+            for (int level = 0; level < scale; ++level) {
+                if (level % 2 == 0) {
+                    bits = stream.next();
+                }
+                std::uint64_t r = (level % 2 == 0) ? (bits >> 32) : (bits & 0xFFFFFFFFu);
+                // Below A: top-left; below A + B: top-right; below A + B + C: bottom-left; otherwise bottom-right.
+                int aboveA = r >= thresholdA;
+                int aboveAB = r >= thresholdAB;
+                int aboveABC = r >= thresholdABC;
+                from = (from << 1) | aboveAB;
+                to = (to << 1) | (aboveA ^ aboveAB ^ aboveABC);
+            }
+            from = scrambler(from);
+            to = scrambler(to);
+            return from != to;
+        };
+
+        // Counting pass: out-degree of every vertex.
+        std::vector<std::atomic<int>> cursors(numVertices);
+        for (auto& cursor : cursors) {
+            cursor.store(0, std::memory_order_relaxed);
+        }
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numEdges, thread, numThreads);
+            Stream stream(seed, 0);
+            int from, to;
+            for (long long i = first; i < last; ++i) {
+                if (endpoints(i, from, to, stream)) {
+                    cursors[from].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+        std::vector<int> offsets = prefixSum(cursors);
+
+        // Fill pass: every edge claims the next slot of its source vertex.
+        std::vector<int> targets(offsets[numVertices]);
+        std::vector<WeightType> weights(offsets[numVertices]);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numEdges, thread, numThreads);
+            Stream stream(seed, 0);
+            int from, to;
+            for (long long i = first; i < last; ++i) {
+                if (endpoints(i, from, to, stream)) {
+                    int slot = cursors[from].fetch_add(1, std::memory_order_relaxed);
+                    targets[slot] = to;
+                    weights[slot] = stream.weight(minWeight, maxWeight);
+                }
+            }
+        });
+
+        // Sort each vertex's edges, which also makes the slot order independent of thread scheduling, and keep the
+        // lightest of every run of parallel edges.
+        std::vector<int> degrees(numVertices);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            std::vector<std::pair<int, WeightType>> buffer;
+            for (int v = first; v < last; ++v) {
+                int begin = offsets[v];
+                buffer.clear();
+                for (int i = begin; i < offsets[v + 1]; ++i) {
+                    buffer.emplace_back(targets[i], weights[i]);
+                }
+                std::sort(buffer.begin(), buffer.end());
+                int count = 0;
+                for (std::size_t i = 0; i < buffer.size(); ++i) {
+                    if (i == 0 || buffer[i].first != buffer[i - 1].first) {
+                        targets[begin + count] = buffer[i].first;
+                        weights[begin + count] = buffer[i].second;
+                        ++count;
+                    }
+                }
+                degrees[v] = count;
+            }
+        });
+
+        // Close the gaps the merged edges left behind.
+        std::vector<int> compactOffsets(numVertices + 1);
+        compactOffsets[0] = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            compactOffsets[v + 1] = compactOffsets[v] + degrees[v];
+        }
+        std::vector<int> compactTargets(compactOffsets[numVertices]);
+        std::vector<WeightType> compactWeights(compactOffsets[numVertices]);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            for (int v = first; v < last; ++v) {
+                std::copy(targets.begin() + offsets[v], targets.begin() + offsets[v] + degrees[v], compactTargets.begin() + compactOffsets[v]);
+                std::copy(weights.begin() + offsets[v], weights.begin() + offsets[v] + degrees[v], compactWeights.begin() + compactOffsets[v]);
+            }
+        });
+        return build(numVertices, std::move(compactOffsets), std::move(compactTargets), std::move(compactWeights));
+    }
+
+    // Builds a random geometric graph: numVertices points placed uniformly in the unit square, with an edge in both
+    // directions between every two points closer than the radius that gives the requested average degree.
+    // An edge's weight is its length in units of that radius times maxWeight, rounded up to at least 1 for integral
+    // weights, so weights lie in (0, maxWeight] and the graph behaves like a road network with straight-line costs.
+    // If coordinates is given, it receives the (x, y) position of every vertex; multiplied by maxWeight / radius, these
+    // give an admissible Euclidean A* heuristic.
+    static GraphCSR<VertexType, WeightType> geometric(int numVertices, double averageDegree, WeightType maxWeight, std::uint64_t seed,
+                                                      int numThreads = 0, std::vector<std::pair<double, double>>* coordinates = nullptr) {
+        if (numVertices < 1 || !(averageDegree >= 0)) {
+            throw std::invalid_argument("Geometric graph sizes out of range");
+        }
+        if (!(maxWeight > 0)) {
+            throw std::invalid_argument("Maximum weight must be positive");
+        }
+        numThreads = resolveThreadCount(numThreads);
+        const double pi = std::acos(-1.0);
+        double radius = std::sqrt(averageDegree / (pi * numVertices));
+
+        // Place the points.
+        std::vector<double> xs(numVertices);
+        std::vector<double> ys(numVertices);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            for (int v = first; v < last; ++v) {
+                Stream stream(seed, static_cast<std::uint64_t>(v));
+                xs[v] = stream.uniform();
+                ys[v] = stream.uniform();
+            }
+        });
+
+        // Bucket the points into square cells at least one radius wide, so all neighbours of a point lie in the 3 x 3
+        // cells around its own; at most about one cell per point is allocated. A counting sort keeps the points of each
+        // cell in index order.
+        int maxSide = static_cast<int>(std::sqrt(static_cast<double>(numVertices))) + 1;
+        int side = radius > 0 ? std::max(1, static_cast<int>(std::min(1 / radius, static_cast<double>(maxSide)))) : maxSide;
+        auto cellOf = [side](double coordinate) {
+            return std::min(static_cast<int>(coordinate * side), side - 1);
+        };
+        std::vector<int> cellStarts(static_cast<std::size_t>(side) * side + 1, 0);
+        for (int v = 0; v < numVertices; ++v) {
+            ++cellStarts[static_cast<std::size_t>(cellOf(ys[v])) * side + cellOf(xs[v]) + 1];
+        }
+        for (std::size_t cell = 0; cell + 1 < cellStarts.size(); ++cell) {
+            cellStarts[cell + 1] += cellStarts[cell];
+        }
+        std::vector<int> cellPoints(numVertices);
+        {
+            std::vector<int> next(cellStarts.begin(), cellStarts.end() - 1);
+            for (int v = 0; v < numVertices; ++v) {
+                cellPoints[next[static_cast<std::size_t>(cellOf(ys[v])) * side + cellOf(xs[v])]++] = v;
+            }
+        }
+
+        // Calls onNeighbor(u, distance) for every point within the radius of v.
+        double radiusSquared = radius * radius;
+        auto forNeighbors = [&](int v, auto onNeighbor) {
+            int cellX = cellOf(xs[v]);
+            int cellY = cellOf(ys[v]);
+            for (int y = std::max(0, cellY - 1); y <= std::min(side - 1, cellY + 1); ++y) {
+                for (int x = std::max(0, cellX - 1); x <= std::min(side - 1, cellX + 1); ++x) {
+                    std::size_t cell = static_cast<std::size_t>(y) * side + x;
+                    for (int i = cellStarts[cell]; i < cellStarts[cell + 1]; ++i) {
+                        int u = cellPoints[i];
+                        double dx = xs[u] - xs[v];
+                        double dy = ys[u] - ys[v];
+                        double distanceSquared = dx * dx + dy * dy;
+                        if (u != v && distanceSquared < radiusSquared) {
+                            onNeighbor(u, std::sqrt(distanceSquared));
+                        }
+                    }
+                }
+            }
+        };
+
+        // Counting pass, prefix sum, then a fill pass that scans the same cells again.
+        std::vector<int> offsets(numVertices + 1);
+        offsets[0] = 0;
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            for (int v = first; v < last; ++v) {
+                int count = 0;
+                forNeighbors(v, [&count](int, double) { ++count; });
+                offsets[v + 1] = count;
+            }
+        });
+        for (int v = 0; v < numVertices; ++v) {
+            if (static_cast<long long>(offsets[v]) + offsets[v + 1] > std::numeric_limits<int>::max()) {
+                throw std::out_of_range("Too many edges");
+            }
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<int> targets(offsets[numVertices]);
+        std::vector<WeightType> weights(offsets[numVertices]);
+        runParallel(numThreads, [&](int thread) {
+            auto [first, last] = block(numVertices, thread, numThreads);
+            std::vector<std::pair<int, WeightType>> buffer;
+            for (int v = first; v < last; ++v) {
+                buffer.clear();
+                forNeighbors(v, [&](int u, double distance) {
+                    buffer.emplace_back(u, lengthWeight(distance / radius * static_cast<double>(maxWeight)));
+                });
+                std::sort(buffer.begin(), buffer.end());
+                for (std::size_t i = 0; i < buffer.size(); ++i) {
+                    targets[offsets[v] + i] = buffer[i].first;
+                    weights[offsets[v] + i] = buffer[i].second;
+                }
+            }
+        });
+
+        if (coordinates != nullptr) {
+            coordinates->resize(numVertices);
+            for (int v = 0; v < numVertices; ++v) {
+                (*coordinates)[v] = {xs[v], ys[v]};
+            }
+        }
+        return build(numVertices, std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+private:
+    // SplitMix64 sequence starting at a point derived from the seed and a key, such as a vertex or edge index.
+    // Streams for different keys are statistically independent, so any item can be generated without the others.
+    class Stream {
+    public:
+        Stream(std::uint64_t seed, std::uint64_t key) : state(mix(seed ^ mix(key + 0x9E3779B97F4A7C15ull))) {}
+
+        // Returns the next 64 random bits.
+        std::uint64_t next() {
+            state += 0x9E3779B97F4A7C15ull;
+            return mix(state);
+        }
+
+        // Returns a uniform double in [0, 1).
+        double uniform() {
+            return static_cast<double>(next() >> 11) * 0x1.0p-53;
+        }
+
+        // Returns a uniform weight in [minWeight, maxWeight] for integral types and [minWeight, maxWeight) otherwise.
+        WeightType weight(WeightType minWeight, WeightType maxWeight) {
+            if constexpr (std::is_integral<WeightType>::value) {
+                std::uint64_t span = static_cast<std::uint64_t>(maxWeight) - static_cast<std::uint64_t>(minWeight) + 1;
+                return static_cast<WeightType>(minWeight + static_cast<WeightType>(span == 0 ? next() : next() % span));
+            } else {
+                return static_cast<WeightType>(minWeight + (maxWeight - minWeight) * uniform());
+            }
+        }
+
+    private:
+        std::uint64_t state;
+
+        // SplitMix64 output function.
+        static std::uint64_t mix(std::uint64_t z) {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+    };
+
+    // Seeded bijection on [0, 2^bits): two rounds of multiplying by an odd constant and xor-shifting, both invertible
+    // modulo 2^bits.
+    class Scrambler {
+    public:
+        Scrambler(int bits, std::uint64_t seed) : mask((std::uint64_t(1) << bits) - 1), shift(std::max(1, bits / 2)) {
+            Stream stream(seed, ~std::uint64_t(0));
+            first = stream.next() | 1;
+            second = stream.next() | 1;
+        }
+
+        int operator()(int vertex) const {
+            std::uint64_t x = static_cast<std::uint64_t>(vertex);
+            x = (x * first) & mask;
+            x ^= x >> shift;
+            x = (x * second) & mask;
+            x ^= x >> shift;
+            return static_cast<int>(x);
+        }
+
+    private:
+        std::uint64_t mask;   // 2^bits - 1.
+        int shift;            // Xor-shift distance.
+        std::uint64_t first;  // Odd multiplier of the first round.
+        std::uint64_t second; // Odd multiplier of the second round.
+    };
+
+    // Converts a length to a weight; integral weights are rounded up so no edge is free.
+    static WeightType lengthWeight(double length) {
+        if constexpr (std::is_integral<WeightType>::value) {
+            return static_cast<WeightType>(std::max(1.0, std::ceil(length)));
+        } else {
+            return static_cast<WeightType>(length);
+        }
+    }
+
+    // Throws unless minWeight <= maxWeight.
+    static void checkWeights(WeightType minWeight, WeightType maxWeight) {
+        if (!(minWeight <= maxWeight)) {
+            throw std::invalid_argument("Minimum weight exceeds maximum weight");
+        }
+    }
+
+    // Returns the half-open range of [0, count) handled by one thread.
+    template <typename Count>
+    static std::pair<Count, Count> block(Count count, int thread, int numThreads) {
+        return {static_cast<Count>(static_cast<long long>(count) * thread / numThreads),
+                static_cast<Count>(static_cast<long long>(count) * (thread + 1) / numThreads)};
+    }
+
+    // Turns per-vertex counters holding degrees into CSR offsets, leaving each counter at the start of its vertex's range.
+    static std::vector<int> prefixSum(std::vector<std::atomic<int>>& cursors) {
+        int numVertices = static_cast<int>(cursors.size());
+        std::vector<int> offsets(numVertices + 1);
+        offsets[0] = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            long long next = static_cast<long long>(offsets[v]) + cursors[v].load(std::memory_order_relaxed);
+            if (next > std::numeric_limits<int>::max()) {
+                throw std::out_of_range("Too many edges");
+            }
+            offsets[v + 1] = static_cast<int>(next);
+            cursors[v].store(offsets[v], std::memory_order_relaxed);
+        }
+        return offsets;
+    }
+
+    // Wraps the finished arrays in a GraphCSR whose vertex values are the indices.
+    static GraphCSR<VertexType, WeightType> build(int numVertices, std::vector<int> offsets, std::vector<int> targets, std::vector<WeightType> weights) {
+        std::vector<VertexType> vertices;
+        vertices.reserve(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            vertices.push_back(static_cast<VertexType>(v));
+        }
+        return GraphCSR<VertexType, WeightType>(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+    }
+};
+
+#endif // GRAPHGENERATOR_H
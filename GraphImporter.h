@@ -0,0 +1,321 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef GRAPHIMPORTER_H
+#define GRAPHIMPORTER_H
+
+#include "GraphCSR.h"
+#include "Parallel.h"
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <charconv>
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Throughput report of a graph import.
+struct ImportStats {
+    std::uint64_t bytes = 0; // Size of the input file.
+    std::uint64_t lines = 0; // Lines parsed, including comments.
+    std::uint64_t edges = 0; // Edges imported.
+    double seconds = 0;      // Wall-clock time of the whole import.
+
+    // Returns the parse throughput in megabytes (10^6 bytes) per second.
+    double megabytesPerSecond() const {
+        return seconds > 0 ? bytes / seconds / 1e6 : 0;
+    }
+};
+
+// Template class GraphImporter, which builds a GraphCSR straight from a text file.
+// The file is memory-mapped and split at line boundaries into one slice per thread. Numbers are parsed in place with
+// std::from_chars, so no line is ever copied into a std::string. The CSR is built without per-edge appends: a counting
+// pass tallies every vertex's out-degree, a prefix sum turns the degrees into offsets, and a fill pass parses the file
+// again and writes each edge into its reserved slot. Each vertex's edges are finally sorted by (target, weight) so the
+// result does not depend on how the threads interleaved.
+// Vertex values are the 0-based vertex indices converted to VertexType.
+template <typename VertexType, typename WeightType>
+class GraphImporter {
+public:
+    // Imports a DIMACS shortest-path file: "c" comment lines, one "p sp <vertices> <arcs>" line, and
+    // "a <from> <to> <weight>" arc lines with 1-based vertex ids.
+    static GraphCSR<VertexType, WeightType> readDimacs(const std::string& path, int numThreads = 0, ImportStats* stats = nullptr) {
+        return import(path, true, numThreads, stats);
+    }
+
+    // Imports a whitespace-separated edge list of "<from> <to> [weight]" lines with 0-based vertex ids.
+    // Lines starting with '#' or '%' are comments, a missing weight defaults to 1, and the vertex count is one more
+    // than the largest id found.
+    static GraphCSR<VertexType, WeightType> readEdgeList(const std::string& path, int numThreads = 0, ImportStats* stats = nullptr) {
+        return import(path, false, numThreads, stats);
+    }
+
+private:
+    // Read-only mapping of the input file, unmapped on destruction.
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path) : data(nullptr), size(0) {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+            }
+            struct stat info;
+            if (::fstat(fd, &info) != 0) {
+                int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "Cannot stat " + path);
+            }
+            size = static_cast<std::size_t>(info.st_size);
+            if (size > 0) {
+                void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                int error = errno;
+                if (mapping == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "Cannot map " + path);
+                }
+                data = static_cast<const char*>(mapping);
+                ::madvise(mapping, size, MADV_SEQUENTIAL); // Let the kernel read ahead in large chunks.
+            }
+            ::close(fd);
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+            if (data != nullptr) {
+                ::munmap(const_cast<char*>(data), size);
+            }
+        }
+
+        const char* data;
+        std::size_t size;
+    };
+
+    // Half-open byte range of the file handled by one thread.
+    struct Slice {
+        const char* begin;
+        const char* end;
+    };
+
+    // Splits the file into one slice per thread, moving every cut to just after a newline.
+    static std::vector<Slice> split(const MappedFile& file, int numThreads) {
+        std::vector<Slice> slices(numThreads);
+        const char* end = file.data + file.size;
+        const char* cut = file.data;
+        for (int thread = 0; thread < numThreads; ++thread) {
+            slices[thread].begin = cut;
+            if (thread + 1 == numThreads) {
+                cut = end;
+            } else {
+                cut = std::max(cut, file.data + file.size / numThreads * (thread + 1));
+                while (cut > file.data && cut < end && cut[-1] != '\n') {
+                    ++cut;
+                }
+            }
+            slices[thread].end = cut;
+        }
+        return slices;
+    }
+
+    // Skips spaces and tabs.
+    static const char* skipBlanks(const char* p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            ++p;
+        }
+        return p;
+    }
+
+    // Parses one number at p, advancing p past it; throws with the byte offset on malformed input.
+    template <typename T>
+    static void parseNumber(const char*& p, const char* end, const char* fileStart, T& value) {
+        p = skipBlanks(p, end);
+        auto result = std::from_chars(p, end, value);
+        if (result.ec != std::errc()) {
+            throw std::runtime_error("Malformed number at byte offset " + std::to_string(p - fileStart));
+        }
+        p = result.ptr;
+    }
+
+    // Parses every edge line of a slice, calling onEdge(from, to, weight) with 0-based ids; returns the number of lines.
+    // In DIMACS mode, ids are converted from 1-based and checked against numVertices. Text after the last field of a line
+    // is rejected with its byte offset.
+    template <typename EdgeFunction>
+    static std::uint64_t parseSlice(const Slice& slice, const char* fileStart, bool dimacs, long long numVertices, EdgeFunction onEdge) {
+        std::uint64_t lines = 0;
+        const char* p = slice.begin;
+        while (p < slice.end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', slice.end - p));
+            if (lineEnd == nullptr) {
+                lineEnd = slice.end;
+            }
+            ++lines;
+            const char* q = skipBlanks(p, lineEnd);
+            bool isEdge = dimacs ? (q < lineEnd && *q == 'a') : (q < lineEnd && *q != '#' && *q != '%');
+            if (isEdge) {
+                if (dimacs) {
+                    ++q; // Skip the 'a' marker.
+                }
+                long long from, to;
+                WeightType weight = 1;
+                parseNumber(q, lineEnd, fileStart, from);
+                parseNumber(q, lineEnd, fileStart, to);
+                if (skipBlanks(q, lineEnd) < lineEnd || dimacs) {
+                    parseNumber(q, lineEnd, fileStart, weight);
+                }
+                q = skipBlanks(q, lineEnd);
+                if (q < lineEnd) {
+                    throw std::runtime_error("Unexpected text at byte offset " + std::to_string(q - fileStart));
+                }
+                if (dimacs) {
+                    --from;
+                    --to;
+                }
+                if (from < 0 || to < 0 || (numVertices >= 0 && (from >= numVertices || to >= numVertices))) {
+                    throw std::out_of_range("Vertex id out of range at byte offset " + std::to_string(p - fileStart));
+                }
+                onEdge(from, to, weight);
+            }
+            p = lineEnd + 1;
+        }
+        return lines;
+    }
+
+    // Finds the vertex count on the "p sp <vertices> <arcs>" line of a DIMACS file.
+    static long long readDimacsVertexCount(const MappedFile& file) {
+        const char* p = file.data;
+        const char* end = file.data + file.size;
+        while (p < end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (lineEnd == nullptr) {
+                lineEnd = end;
+            }
+            const char* q = skipBlanks(p, lineEnd);
+            if (q < lineEnd && *q == 'p') {
+                q = skipBlanks(q + 1, lineEnd);
+                while (q < lineEnd && *q != ' ' && *q != '\t') {
+                    ++q; // Skip the problem type, normally "sp".
+                }
+                long long numVertices;
+                parseNumber(q, lineEnd, file.data, numVertices);
+                if (numVertices < 0 || numVertices > std::numeric_limits<int>::max()) {
+                    throw std::out_of_range("DIMACS vertex count out of range");
+                }
+                return numVertices;
+            }
+            p = lineEnd + 1;
+        }
+        throw std::runtime_error("DIMACS file has no problem line");
+    }
+
+    // Shared implementation of both formats.
+    static GraphCSR<VertexType, WeightType> import(const std::string& path, bool dimacs, int numThreads, ImportStats* stats) {
+        auto start = std::chrono::steady_clock::now();
+        numThreads = resolveThreadCount(numThreads);
+        MappedFile file(path);
+        std::vector<Slice> slices = split(file, numThreads);
+
+        // Determine the vertex count: from the problem line, or from the largest id in an edge list.
+        long long numVertices;
+        if (dimacs) {
+            numVertices = readDimacsVertexCount(file);
+        } else {
+            std::vector<long long> maxIds(numThreads, -1);
+            runParallel(numThreads, [&](int thread) {
+                parseSlice(slices[thread], file.data, false, -1, [&maxIds, thread](long long from, long long to, WeightType) {
+                    maxIds[thread] = std::max(maxIds[thread], std::max(from, to));
+                });
+            });
+            numVertices = *std::max_element(maxIds.begin(), maxIds.end()) + 1;
+            if (numVertices > std::numeric_limits<int>::max()) {
+                throw std::out_of_range("Vertex id out of range");
+            }
+        }
+        int n = static_cast<int>(numVertices);
+
+        // Counting pass: out-degree of every vertex.
+        std::vector<std::atomic<int>> cursors(n);
+        for (auto& cursor : cursors) {
+            cursor.store(0, std::memory_order_relaxed);
+        }
+        runParallel(numThreads, [&](int thread) {
+            parseSlice(slices[thread], file.data, dimacs, numVertices, [&cursors](long long from, long long, WeightType) {
+                cursors[from].fetch_add(1, std::memory_order_relaxed);
+            });
+        });
+
+        // Prefix sum: offsets, and a per-vertex cursor at the start of each edge range.
+        std::vector<int> offsets(n + 1);
+        offsets[0] = 0;
+        for (int v = 0; v < n; ++v) {
+            long long next = static_cast<long long>(offsets[v]) + cursors[v].load(std::memory_order_relaxed);
+            if (next > std::numeric_limits<int>::max()) {
+                throw std::out_of_range("Too many edges");
+            }
+            offsets[v + 1] = static_cast<int>(next);
+            cursors[v].store(offsets[v], std::memory_order_relaxed);
+        }
+
+        // Fill pass: every edge claims the next slot of its source vertex.
+        std::vector<int> targets(offsets[n]);
+        std::vector<WeightType> weights(offsets[n]);
+        std::vector<std::uint64_t> lineCounts(numThreads, 0);
+        runParallel(numThreads, [&](int thread) {
+            lineCounts[thread] = parseSlice(slices[thread], file.data, dimacs, numVertices,
+                                            [&cursors, &targets, &weights](long long from, long long to, WeightType weight) {
+                int slot = cursors[from].fetch_add(1, std::memory_order_relaxed);
+                targets[slot] = static_cast<int>(to);
+                weights[slot] = weight;
+            });
+        });
+
+        // Sort each vertex's edges so the result is independent of thread scheduling.
+        runParallel(numThreads, [&](int thread) {
+            std::vector<std::pair<int, WeightType>> buffer;
+            for (int v = thread; v < n; v += numThreads) {
+                int first = offsets[v];
+                int last = offsets[v + 1];
+                buffer.clear();
+                for (int i = first; i < last; ++i) {
+                    buffer.emplace_back(targets[i], weights[i]);
+                }
+                std::sort(buffer.begin(), buffer.end());
+                for (int i = first; i < last; ++i) {
+                    targets[i] = buffer[i - first].first;
+                    weights[i] = buffer[i - first].second;
+                }
+            }
+        });
+
+        std::vector<VertexType> vertices;
+        vertices.reserve(n);
+        for (int v = 0; v < n; ++v) {
+            vertices.push_back(static_cast<VertexType>(v));
+        }
+        GraphCSR<VertexType, WeightType> graph(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+
+        if (stats != nullptr) {
+            stats->bytes = file.size;
+            stats->lines = 0;
+            for (std::uint64_t lines : lineCounts) {
+                stats->lines += lines;
+            }
+            stats->edges = graph.edgeCount();
+            stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        return graph;
+    }
+};
+
+#endif // GRAPHIMPORTER_H
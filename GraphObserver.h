@@ -0,0 +1,69 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef GRAPHOBSERVER_H
+#define GRAPHOBSERVER_H
+
+#include <vector>
+#include <algorithm>
+
+// Interface for objects that keep derived state, such as a shortest-path tree, in step with a mutable graph.
+// The graph calls these after each mutation has been applied, so the observer sees the graph's new state.
+template <typename WeightType>
+class GraphObserver {
+public:
+    virtual ~GraphObserver() {}
+
+    // Called after a vertex is added at the given index.
+    virtual void vertexAdded(int vertexIndex) = 0;
+
+    // Called after a vertex and all edges touching it are removed. Other indices do not change.
+    virtual void vertexRemoved(int vertexIndex) = 0;
+
+    // Called after the graph renumbers its vertices; newIndices maps every old index to its new one, or to -1 for removed vertices.
+    virtual void verticesRenumbered(const std::vector<int>& newIndices) = 0;
+
+    // Called after an edge is added.
+    virtual void edgeAdded(int fromVertex, int toVertex, WeightType weight) = 0;
+
+    // Called after every edge from fromVertex to toVertex is removed.
+    virtual void edgeRemoved(int fromVertex, int toVertex) = 0;
+
+    // Called after every edge from fromVertex to toVertex is given a new weight.
+    virtual void edgeWeightChanged(int fromVertex, int toVertex, WeightType weight) = 0;
+};
+
+// The observers subscribed to one graph.
+// Subscriptions belong to the graph object, not its contents: copying a graph gives the copy no observers.
+template <typename WeightType>
+class GraphObserverList {
+private:
+    std::vector<GraphObserver<WeightType>*> observers; // Subscribed observers, notified in subscription order.
+
+public:
+    GraphObserverList() {}
+    GraphObserverList(const GraphObserverList&) {}
+    GraphObserverList& operator=(const GraphObserverList&) { return *this; }
+
+    // Adds an observer; subscribing the same observer twice has no effect.
+    void subscribe(GraphObserver<WeightType>* observer) {
+        if (std::find(observers.begin(), observers.end(), observer) == observers.end()) {
+            observers.push_back(observer);
+        }
+    }
+
+    // Removes an observer if it is subscribed.
+    void unsubscribe(GraphObserver<WeightType>* observer) {
+        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+    }
+
+    // Calls notify(observer) for every subscribed observer.
+    template <typename Notify>
+    void notify(Notify notify) const {
+        for (GraphObserver<WeightType>* observer : observers) {
+            notify(*observer);
+        }
+    }
+};
+
+#endif // GRAPHOBSERVER_H
@@ -0,0 +1,167 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef INDEXEDDARYHEAP_H
+#define INDEXEDDARYHEAP_H
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+// A template class IndexedDaryHeap that keeps at most one entry per integer id in the range [0, capacity).
+// A position map from id to heap slot supports decreaseKey in O(log_d n), so the heap never holds stale duplicates.
+// Arity selects the branching factor; wider heaps (4 or 8) are shallower and scan children from one cache line.
+template <typename Key, int Arity = 4>
+class IndexedDaryHeap {
+    static_assert(Arity >= 2, "IndexedDaryHeap arity must be at least 2");
+
+private:
+    std::vector<std::pair<Key, int>> data; // Heap entries as (key, id) pairs.
+    std::vector<int> position;             // Slot of each id in data, or -1 if the id is not in the heap.
+
+    // Restores the heap property by moving the entry at the given index up the tree.
+    void siftUp(int index) {
+        std::pair<Key, int> entry = data[index];
+        // Shift larger parents down into the hole until the entry's slot is found.
+        while (index > 0 && entry.first < data[parent(index)].first) {
+            data[index] = data[parent(index)];
+            position[data[index].second] = index;
+            index = parent(index);
+        }
+        data[index] = entry;
+        position[entry.second] = index;
+    }
+
+    // Restores the heap property by moving the entry at the given index down the tree.
+    void siftDown(int index) {
+        std::pair<Key, int> entry = data[index];
+        int count = static_cast<int>(data.size());
+        while (true) {
+            int first = firstChild(index);
+            if (first >= count) {
+                break; // The hole is a leaf.
+            }
+            // Find the smallest of up to Arity children.
+            int last = first + Arity < count ? first + Arity : count;
+            int smallest = first;
+            for (int child = first + 1; child < last; ++child) {
+                if (data[child].first < data[smallest].first) {
+                    smallest = child;
+                }
+            }
+            if (!(data[smallest].first < entry.first)) {
+                break; // The entry is no larger than any child.
+            }
+            // Shift the smallest child up into the hole.
+            data[index] = data[smallest];
+            position[data[index].second] = index;
+            index = smallest;
+        }
+        data[index] = entry;
+        position[entry.second] = index;
+    }
+
+    // Helper to get the parent's index of a given index.
+    int parent(int index) const { return (index - 1) / Arity; }
+    // Helper to get the first child's index of a given index.
+    int firstChild(int index) const { return Arity * index + 1; }
+
+public:
+    // Constructor initializes an empty heap able to hold ids in [0, capacity).
+    explicit IndexedDaryHeap(int capacity = 0) : position(capacity, -1) {}
+
+    // Empties the heap and makes room for ids in [0, capacity).
+    // Only the ids still in the heap are touched, so resetting after a partial search is cheap.
+    void reset(int capacity) {
+        for (const auto& entry : data) {
+            position[entry.second] = -1;
+        }
+        data.clear();
+        if (static_cast<int>(position.size()) < capacity) {
+            position.resize(capacity, -1);
+        }
+    }
+
+    // Checks if an id currently has an entry in the heap.
+    bool contains(int id) const {
+        return id >= 0 && id < static_cast<int>(position.size()) && position[id] != -1;
+    }
+
+    // Returns the current key of an id in the heap.
+    Key keyOf(int id) const {
+        if (!contains(id)) {
+            throw std::out_of_range("Id is not in the heap");
+        }
+        return data[position[id]].first;
+    }
+
+    // Inserts a new id with the given key.
+    void insert(int id, Key key) {
+        if (id < 0 || id >= static_cast<int>(position.size())) {
+            throw std::out_of_range("Heap id out of range");
+        }
+        if (position[id] != -1) {
+            throw std::invalid_argument("Id is already in the heap");
+        }
+        data.emplace_back(key, id);
+        siftUp(static_cast<int>(data.size()) - 1);
+    }
+
+    // Lowers the key of an id already in the heap.
+    void decreaseKey(int id, Key key) {
+        if (!contains(id)) {
+            throw std::out_of_range("Id is not in the heap");
+        }
+        int index = position[id];
+        if (data[index].first < key) {
+            throw std::invalid_argument("New key is larger than the current key");
+        }
+        data[index].first = key;
+        siftUp(index);
+    }
+
+    // Inserts the id, or lowers its key if it is already present.
+    // This is the operation Dijkstra's relaxation step uses.
+    void push(int id, Key key) {
+        if (contains(id)) {
+            decreaseKey(id, key);
+        } else {
+            insert(id, key);
+        }
+    }
+
+    // Extracts the entry with the minimum key as a (key, id) pair.
+    std::pair<Key, int> extractMin() {
+        if (data.empty()) {
+            throw std::range_error("Heap is empty"); // Safety check.
+        }
+        std::pair<Key, int> minEntry = data[0];
+        position[minEntry.second] = -1;
+        data[0] = data.back(); // Replace the root with the last entry.
+        data.pop_back();
+        if (!data.empty()) {
+            siftDown(0); // Restore the heap property from the root down.
+        }
+        return minEntry;
+    }
+
+    // Returns the entry with the minimum key without removing it.
+    std::pair<Key, int> peek() const {
+        if (data.empty()) {
+            throw std::range_error("Heap is empty"); // Safety check.
+        }
+        return data[0];
+    }
+
+    // Checks if the heap is empty.
+    bool isEmpty() const {
+        return data.empty();
+    }
+
+    // Returns the number of entries in the heap.
+    int size() const {
+        return static_cast<int>(data.size());
+    }
+};
+
+#endif // INDEXEDDARYHEAP_H
@@ -0,0 +1,439 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef MAPPEDGRAPH_H
+#define MAPPEDGRAPH_H
+
+#include "Graph.h"
+#include "GraphCSR.h"
+#include "GraphAlgorithm.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cerrno>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <iomanip>
+#include <cmath>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Fixed-size header at the start of every binary graph file.
+// The file then holds four sections, each starting at an 8-byte aligned offset recorded here:
+// the vertex values, the CSR offsets (numVertices + 1 ints), the edge targets (numEdges ints) and the edge weights.
+// All values are stored in the native byte order of the machine that wrote the file.
+struct GraphFileHeader {
+    char magic[8];              // "DIJKGRF" followed by a NUL byte.
+    std::uint32_t version;      // Format version, currently 1.
+    std::uint32_t vertexSize;   // sizeof(VertexType) used by the writer.
+    std::uint32_t weightSize;   // sizeof(WeightType) used by the writer.
+    std::uint32_t reserved;     // Always zero.
+    std::uint64_t numVertices;  // Number of vertices.
+    std::uint64_t numEdges;     // Number of edges.
+    std::uint64_t verticesOffset;
+    std::uint64_t offsetsOffset;
+    std::uint64_t targetsOffset;
+    std::uint64_t weightsOffset;
+    std::uint64_t fileSize;     // Total size of the file in bytes.
+    std::uint64_t checksum;     // 64-bit FNV-1a hash of every byte after the header.
+};
+
+// Template class for MappedGraph, a read-only graph backed by a memory-mapped binary graph file.
+// Opening a file maps it and validates its header without reading the edge data, so startup is O(1) in graph size.
+// Pages are loaded on first touch and shared through the page cache by every process mapping the same file.
+// Edges are exposed through the same zero-copy edges() range as GraphCSR, so Dijkstra walks the mapping directly.
+template <typename VertexType, typename WeightType>
+class MappedGraph final : public Graph<VertexType, WeightType> {
+    static_assert(std::is_trivially_copyable<VertexType>::value, "MappedGraph requires a trivially copyable VertexType");
+    static_assert(std::is_trivially_copyable<WeightType>::value, "MappedGraph requires a trivially copyable WeightType");
+
+public:
+    using EdgeRange = typename GraphCSR<VertexType, WeightType>::EdgeRange;
+
+    static constexpr std::uint32_t FormatVersion = 1;
+
+    // Maps a binary graph file. The checksum covers every byte after the header, so verifying it is O(size) and off by default;
+    // call verifyChecksum() separately (for example once after a download) when integrity matters more than startup time.
+    // Edge targets are not range-checked at open time either, so files from untrusted sources should be verified.
+    explicit MappedGraph(const std::string& path, bool checkIntegrity = false) : data(nullptr), size(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open graph file " + path);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot stat graph file " + path);
+        }
+        size = static_cast<std::size_t>(info.st_size);
+        if (size < sizeof(GraphFileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Graph file is too small: " + path);
+        }
+        void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        int error = errno;
+        ::close(fd); // The mapping stays valid after the descriptor is closed.
+        if (mapping == MAP_FAILED) {
+            throw std::system_error(error, std::generic_category(), "Cannot map graph file " + path);
+        }
+        data = static_cast<const char*>(mapping);
+
+        try {
+            validateHeader();
+            if (checkIntegrity && !verifyChecksum()) {
+                throw std::runtime_error("Graph file checksum mismatch: " + path);
+            }
+        } catch (...) {
+            ::munmap(const_cast<char*>(data), size);
+            throw;
+        }
+    }
+
+    // The mapping is owned exclusively, so a MappedGraph can be moved but not copied.
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+
+    MappedGraph(MappedGraph&& other) noexcept
+        : data(other.data), size(other.size), header(other.header), vertices(other.vertices),
+          offsets(other.offsets), targets(other.targets), weights(other.weights) {
+        other.data = nullptr;
+        other.size = 0;
+    }
+
+    // Destructor unmaps the file.
+    virtual ~MappedGraph() {
+        if (data != nullptr) {
+            ::munmap(const_cast<char*>(data), size);
+        }
+    }
+
+    // Writes any graph to a binary graph file that MappedGraph can map.
+    // The graph is streamed section by section, so no second in-memory copy is built. The file is written under a
+    // temporary name in the same directory through a single descriptor, synced, renamed over the target, and the directory
+    // is synced after the rename. Processes that still map the old file keep reading it intact, and after a crash the
+    // target holds either the old graph or the complete new one.
+    // Throws std::length_error if the graph has more edges than an int offset can address.
+    template <typename GraphType>
+    static void write(const GraphType& graph, const std::string& path) {
+        int numVertices = graph.vertexCount();
+        std::uint64_t numEdges = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            numEdges += GraphAlgorithm::neighborsOf(graph, v).size();
+        }
+        if (numEdges > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+            throw std::length_error("Graph has too many edges for a binary graph file");
+        }
+
+        GraphFileHeader fileHeader = {};
+        std::memcpy(fileHeader.magic, FileMagic, sizeof(fileHeader.magic));
+        fileHeader.version = FormatVersion;
+        fileHeader.vertexSize = sizeof(VertexType);
+        fileHeader.weightSize = sizeof(WeightType);
+        fileHeader.numVertices = static_cast<std::uint64_t>(numVertices);
+        fileHeader.numEdges = numEdges;
+        fileHeader.verticesOffset = alignUp(sizeof(GraphFileHeader));
+        fileHeader.offsetsOffset = alignUp(fileHeader.verticesOffset + fileHeader.numVertices * sizeof(VertexType));
+        fileHeader.targetsOffset = alignUp(fileHeader.offsetsOffset + (fileHeader.numVertices + 1) * sizeof(int));
+        fileHeader.weightsOffset = alignUp(fileHeader.targetsOffset + numEdges * sizeof(int));
+        fileHeader.fileSize = fileHeader.weightsOffset + numEdges * sizeof(WeightType);
+
+        std::string temporaryPath = path + ".XXXXXX";
+        int fd = ::mkstemp(&temporaryPath[0]);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot create graph file " + path);
+        }
+        try {
+            ::fchmod(fd, 0644); // mkstemp creates the file private to its owner.
+
+            // Every section is written through the writer, which pads, counts and hashes the payload. The header is
+            // written last, once the checksum is known.
+            SectionWriter writer(fd, path, sizeof(GraphFileHeader));
+            writer.padTo(fileHeader.verticesOffset);
+            for (int v = 0; v < numVertices; ++v) {
+                VertexType vertex = graph.getVertex(v);
+                writer.write(&vertex, sizeof(vertex));
+            }
+            writer.padTo(fileHeader.offsetsOffset);
+            int offset = 0;
+            writer.write(&offset, sizeof(offset));
+            for (int v = 0; v < numVertices; ++v) {
+                offset += static_cast<int>(GraphAlgorithm::neighborsOf(graph, v).size());
+                writer.write(&offset, sizeof(offset));
+            }
+            writer.padTo(fileHeader.targetsOffset);
+            for (int v = 0; v < numVertices; ++v) {
+                for (const auto& edge : GraphAlgorithm::neighborsOf(graph, v)) {
+                    int target = edge.first;
+                    writer.write(&target, sizeof(target));
+                }
+            }
+            writer.padTo(fileHeader.weightsOffset);
+            for (int v = 0; v < numVertices; ++v) {
+                for (const auto& edge : GraphAlgorithm::neighborsOf(graph, v)) {
+                    WeightType weight = edge.second;
+                    writer.write(&weight, sizeof(weight));
+                }
+            }
+
+            writer.flush();
+            fileHeader.checksum = writer.checksum();
+            writeAt(fd, path, reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader), 0);
+            if (::fsync(fd) != 0) {
+                throw std::system_error(errno, std::generic_category(), "Cannot sync graph file " + path);
+            }
+            int closed = ::close(fd);
+            fd = -1;
+            if (closed != 0) {
+                throw std::system_error(errno, std::generic_category(), "Cannot write graph file " + path);
+            }
+            if (::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+                throw std::system_error(errno, std::generic_category(), "Cannot replace graph file " + path);
+            }
+            syncParentDirectory(path);
+        } catch (...) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            ::unlink(temporaryPath.c_str());
+            throw;
+        }
+    }
+
+    // Recomputes the checksum over the mapped payload and compares it with the header.
+    bool verifyChecksum() const {
+        return fnv1a(FnvOffsetBasis, data + sizeof(GraphFileHeader), size - sizeof(GraphFileHeader)) == header.checksum;
+    }
+
+    // Returns a view over the outgoing edges of a vertex, pointing straight into the mapping.
+    EdgeRange edges(int vertex) const {
+        int first = offsets[vertex];
+        return EdgeRange(targets + first, weights + first, offsets[vertex + 1] - first);
+    }
+
+    // Returns the number of outgoing edges of a vertex.
+    int degree(int vertex) const {
+        return offsets[vertex + 1] - offsets[vertex];
+    }
+
+    // Returns the total number of edges in the graph.
+    int edgeCount() const {
+        return static_cast<int>(header.numEdges);
+    }
+
+    // A MappedGraph is read-only; build a mutable graph, write it again and remap to change it.
+    int addVertex(VertexType) override {
+        throw std::logic_error("MappedGraph is read-only");
+    }
+
+    void removeVertex(int) override {
+        throw std::logic_error("MappedGraph is read-only");
+    }
+
+    void addEdge(int, int, WeightType) override {
+        throw std::logic_error("MappedGraph is read-only");
+    }
+
+    void removeEdge(int, int) override {
+        throw std::logic_error("MappedGraph is read-only");
+    }
+
+    // Retrieves a copy of all neighbors and their edge weights for a given vertex.
+    // Prefer edges() on hot paths, which exposes the same data without allocating.
+    std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const override {
+        std::vector<std::pair<int, WeightType>> neighbors;
+        neighbors.reserve(degree(vertex));
+        for (const auto& edge : edges(vertex)) {
+            neighbors.push_back(edge);
+        }
+        return neighbors;
+    }
+
+    // Retrieves the weight of an edge between two specified vertices.
+    WeightType getEdgeWeight(int fromVertex, int toVertex) const override {
+        for (int i = offsets[fromVertex]; i < offsets[fromVertex + 1]; ++i) {
+            if (targets[i] == toVertex) {
+                return weights[i];
+            }
+        }
+        throw std::range_error("Edge does not exist");
+    }
+
+    // Returns the vertex stored at the given index.
+    VertexType getVertex(int vertexIndex) const override {
+        if (vertexIndex < 0 || vertexIndex >= vertexCount()) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        VertexType vertex;
+        std::memcpy(&vertex, vertices + static_cast<std::size_t>(vertexIndex) * sizeof(VertexType), sizeof(VertexType));
+        return vertex;
+    }
+
+    // Returns the current number of vertices in the graph.
+    int vertexCount() const override {
+        return static_cast<int>(header.numVertices);
+    }
+
+    // Prints the entire graph in adjacency list form along with vertex identifiers.
+    void print() const override {
+        std::cout << "Graph (Memory-Mapped CSR Representation):" << std::endl;
+        for (int i = 0; i < vertexCount(); ++i) {
+            std::cout << getVertex(i) << " -> ";
+            for (const auto& edge : edges(i)) {
+                std::cout << "(" << getVertex(edge.first) << ", " << std::fixed << std::setprecision(1) << round(edge.second * 10) / 10 << ") ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+private:
+    static constexpr char FileMagic[8] = {'D', 'I', 'J', 'K', 'G', 'R', 'F', '\0'};
+    static constexpr std::uint64_t FnvOffsetBasis = 14695981039346656037ULL;
+    static constexpr std::uint64_t FnvPrime = 1099511628211ULL;
+
+    const char* data;        // Start of the mapping.
+    std::size_t size;        // Length of the mapping in bytes.
+    GraphFileHeader header;  // Copy of the validated header.
+    const char* vertices;    // Vertex section; read with memcpy since VertexType may need stricter alignment.
+    const int* offsets;      // CSR offsets section.
+    const int* targets;      // Edge targets section.
+    const WeightType* weights; // Edge weights section.
+
+    // Streams file sections through a descriptor in large buffered writes, tracking the position and hashing every byte
+    // after the header. flush() must be called once the last section is written.
+    class SectionWriter {
+    public:
+        static constexpr std::size_t BufferSize = 1 << 16; // Bytes collected before each write to the descriptor.
+
+        SectionWriter(int fd, const std::string& path, std::uint64_t position)
+            : fd(fd), path(path), position(position), flushed(position), hash(FnvOffsetBasis) {
+            buffer.reserve(BufferSize);
+        }
+
+        void write(const void* bytes, std::size_t length) {
+            const char* first = static_cast<const char*>(bytes);
+            buffer.insert(buffer.end(), first, first + length);
+            hash = fnv1a(hash, first, length);
+            position += length;
+            if (buffer.size() >= BufferSize) {
+                flush();
+            }
+        }
+
+        void flush() {
+            writeAt(fd, path, buffer.data(), buffer.size(), flushed);
+            flushed = position;
+            buffer.clear();
+        }
+
+        void padTo(std::uint64_t offset) {
+            static const char zeros[8] = {};
+            while (position < offset) {
+                write(zeros, std::min<std::uint64_t>(sizeof(zeros), offset - position));
+            }
+        }
+
+        std::uint64_t checksum() const { return hash; }
+
+    private:
+        int fd;                   // Descriptor of the file being written.
+        const std::string& path;  // Target path, for error messages.
+        std::vector<char> buffer; // Bytes not yet written to the descriptor.
+        std::uint64_t position;   // File position after the buffered bytes.
+        std::uint64_t flushed;    // File position of the first buffered byte.
+        std::uint64_t hash;       // FNV-1a hash of every byte written so far.
+    };
+
+    // Writes a byte range at a file offset, retrying short and interrupted writes.
+    static void writeAt(int fd, const std::string& path, const char* bytes, std::size_t length, std::uint64_t offset) {
+        while (length > 0) {
+            ssize_t written = ::pwrite(fd, bytes, length, static_cast<off_t>(offset));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "Cannot write graph file " + path);
+            }
+            bytes += written;
+            length -= static_cast<std::size_t>(written);
+            offset += static_cast<std::uint64_t>(written);
+        }
+    }
+
+    // Syncs the directory holding a path, so a rename into it survives a crash.
+    static void syncParentDirectory(const std::string& path) {
+        std::string::size_type slash = path.find_last_of('/');
+        std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+        int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot open directory of graph file " + path);
+        }
+        int synced = ::fsync(fd);
+        int error = errno;
+        ::close(fd);
+        if (synced != 0) {
+            throw std::system_error(error, std::generic_category(), "Cannot sync directory of graph file " + path);
+        }
+    }
+
+    // Rounds a file offset up to the next multiple of 8 bytes.
+    static std::uint64_t alignUp(std::uint64_t offset) {
+        return (offset + 7) & ~static_cast<std::uint64_t>(7);
+    }
+
+    // Continues a 64-bit FNV-1a hash over a byte range.
+    static std::uint64_t fnv1a(std::uint64_t hash, const char* bytes, std::size_t length) {
+        for (std::size_t i = 0; i < length; ++i) {
+            hash ^= static_cast<unsigned char>(bytes[i]);
+            hash *= FnvPrime;
+        }
+        return hash;
+    }
+
+    // Checks whether count elements of elementSize bytes starting at offset end by limit, without overflowing.
+    static bool sectionFits(std::uint64_t offset, std::uint64_t count, std::uint64_t elementSize, std::uint64_t limit) {
+        return offset <= limit && count <= (limit - offset) / elementSize;
+    }
+
+    // Checks the header against this instantiation and the file size, then points the sections into the mapping.
+    void validateHeader() {
+        std::memcpy(&header, data, sizeof(header));
+        if (std::memcmp(header.magic, FileMagic, sizeof(header.magic)) != 0) {
+            throw std::runtime_error("Not a binary graph file");
+        }
+        if (header.version != FormatVersion) {
+            throw std::runtime_error("Unsupported graph file version");
+        }
+        if (header.vertexSize != sizeof(VertexType) || header.weightSize != sizeof(WeightType)) {
+            throw std::runtime_error("Graph file was written with different vertex or weight types");
+        }
+        if (header.fileSize != size || header.numVertices > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+            header.numEdges > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+            header.verticesOffset < sizeof(GraphFileHeader) ||
+            !sectionFits(header.verticesOffset, header.numVertices, sizeof(VertexType), header.offsetsOffset) ||
+            !sectionFits(header.offsetsOffset, header.numVertices + 1, sizeof(int), header.targetsOffset) ||
+            !sectionFits(header.targetsOffset, header.numEdges, sizeof(int), header.weightsOffset) ||
+            !sectionFits(header.weightsOffset, header.numEdges, sizeof(WeightType), size) ||
+            header.offsetsOffset % alignof(int) != 0 || header.targetsOffset % alignof(int) != 0 ||
+            header.weightsOffset % alignof(WeightType) != 0) {
+            throw std::runtime_error("Corrupt graph file header");
+        }
+        vertices = data + header.verticesOffset;
+        offsets = reinterpret_cast<const int*>(data + header.offsetsOffset);
+        targets = reinterpret_cast<const int*>(data + header.targetsOffset);
+        weights = reinterpret_cast<const WeightType*>(data + header.weightsOffset);
+        if (offsets[0] != 0 || offsets[header.numVertices] != static_cast<int>(header.numEdges)) {
+            throw std::runtime_error("Corrupt graph file offsets");
+        }
+    }
+};
+
+#endif // MAPPEDGRAPH_H
@@ -1,5 +1,5 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef MINHEAP_H
 #define MINHEAP_H
@@ -25,23 +25,27 @@ private:
 
     // Restores the heap property by moving the element at the given index down the tree.
     void heapifyDown(int index) {
-        int smallest = index; // Start with the current index as the smallest.
-        int leftIndex = leftChild(index); // Get the left child index.
-        int rightIndex = rightChild(index); // Get the right child index.
+        int count = static_cast<int>(data.size());
+        while (true) {
+            int smallest = index; // Start with the current index as the smallest.
+            int leftIndex = leftChild(index); // Get the left child index.
+            int rightIndex = rightChild(index); // Get the right child index.
 
-        // Determine if the left child exists and is smaller than the current smallest.
-        if (leftIndex < data.size() && data[leftIndex] < data[smallest]) {
-            smallest = leftIndex;
-        }
-        // Determine if the right child exists and is smaller than the current smallest.
-        if (rightIndex < data.size() && data[rightIndex] < data[smallest]) {
-            smallest = rightIndex;
-        }
+            // Determine if the left child exists and is smaller than the current smallest.
+            if (leftIndex < count && data[leftIndex] < data[smallest]) {
+                smallest = leftIndex;
+            }
+            // Determine if the right child exists and is smaller than the current smallest.
+            if (rightIndex < count && data[rightIndex] < data[smallest]) {
+                smallest = rightIndex;
+            }
 
-        // If the smallest is not the current index, swap and continue heapifying down.
-        if (smallest != index) {
+            // Stop once the element is no larger than its children; otherwise swap and continue down.
+            if (smallest == index) {
+                break;
+            }
             std::swap(data[index], data[smallest]);
-            heapifyDown(smallest);
+            index = smallest;
         }
     }
 
@@ -93,6 +97,11 @@ public:
     int size() const {
         return data.size();
     }
+
+    // Removes all elements while keeping the allocated capacity.
+    void clear() {
+        data.clear();
+    }
 };
 
 #endif // MINHEAP_H
@@ -0,0 +1,228 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef NODEALLOCATOR_H
+#define NODEALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+// Memory resources for node-based containers such as SinglyLinkedList and the edge lists of GraphAdjacencyList.
+// Allocating every node separately from the heap scatters small blocks across memory and makes building large graphs
+// allocator-bound. Both resources here carve nodes out of large chunks instead, so consecutively added nodes sit next to
+// each other, and release() returns all of their memory with one free per chunk. Neither resource is thread-safe, and
+// each must outlive every container that allocates from it. Containers use them through ArenaAllocator or PoolAllocator.
+
+// Bump allocator: every allocation takes the next bytes of the current chunk, and deallocation does nothing.
+// Suited to data that is built once and dropped as a whole, such as a graph or a batch of paths.
+class Arena {
+private:
+    // Header at the start of every chunk, linking the chunks for release().
+    struct Chunk {
+        Chunk* next; // Previously allocated chunk.
+    };
+
+    static constexpr std::size_t MinChunkBytes = 64 * 1024;        // Size of the first chunk.
+    static constexpr std::size_t MaxChunkBytes = 16 * 1024 * 1024; // Chunks stop doubling at this size.
+
+    Chunk* chunks;              // Most recent chunk, or null.
+    char* cursor;               // Next free byte of the most recent chunk.
+    char* limit;                // End of the most recent chunk.
+    std::size_t nextChunkBytes; // Size of the next chunk to allocate.
+    std::size_t reserved;       // Bytes held in chunks.
+
+    // Allocates a chunk with room for at least the given bytes at the given alignment and makes it current.
+    void grow(std::size_t bytes, std::size_t alignment) {
+        std::size_t needed = sizeof(Chunk) + bytes + alignment;
+        std::size_t chunkBytes = std::max(nextChunkBytes, needed);
+        Chunk* chunk = static_cast<Chunk*>(::operator new(chunkBytes));
+        chunk->next = chunks;
+        chunks = chunk;
+        cursor = reinterpret_cast<char*>(chunk + 1);
+        limit = reinterpret_cast<char*>(chunk) + chunkBytes;
+        reserved += chunkBytes;
+        nextChunkBytes = std::min(nextChunkBytes * 2, MaxChunkBytes);
+    }
+
+public:
+    // Constructor creates an empty arena; the first allocation reserves the first chunk.
+    Arena() : chunks(nullptr), cursor(nullptr), limit(nullptr), nextChunkBytes(MinChunkBytes), reserved(0) {}
+
+    // The arena owns its chunks, so it can be neither copied nor moved.
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Destructor frees every chunk.
+    ~Arena() {
+        release();
+    }
+
+    // Returns the given number of bytes at the given power-of-two alignment.
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        if (cursor == nullptr || address + bytes > reinterpret_cast<std::uintptr_t>(limit)) {
+            grow(bytes, alignment);
+            address = (reinterpret_cast<std::uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        }
+        cursor = reinterpret_cast<char*>(address + bytes);
+        return reinterpret_cast<void*>(address);
+    }
+
+    // Does nothing: memory is only returned by release().
+    void deallocate(void*, std::size_t, std::size_t) {}
+
+    // Frees every chunk at once, invalidating everything allocated from the arena. Runs in time proportional to the
+    // number of chunks, which grow geometrically, not to the number of allocations.
+    void release() {
+        while (chunks != nullptr) {
+            Chunk* next = chunks->next;
+            ::operator delete(chunks);
+            chunks = next;
+        }
+        cursor = nullptr;
+        limit = nullptr;
+        nextChunkBytes = MinChunkBytes;
+        reserved = 0;
+    }
+
+    // Returns the number of bytes the arena holds in chunks.
+    std::size_t bytesReserved() const {
+        return reserved;
+    }
+};
+
+// Pool of fixed-size blocks: requests are rounded up to a multiple of 16 bytes, and each such size class keeps a free
+// list of returned blocks that later requests of the class reuse before new memory is carved from an arena.
+// Suited to nodes that are added and removed over time, such as the edges of a graph under mutation.
+// Requests above MaxBlockBytes, which node containers do not make, and over-aligned ones go straight to the heap.
+class NodePool {
+private:
+    // A returned block, linked into its class's free list.
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr std::size_t Granularity = 16;   // Block sizes are multiples of this, which is also their alignment.
+    static constexpr std::size_t MaxBlockBytes = 512; // Largest pooled block.
+
+    Arena arena;                        // Source of new blocks.
+    std::vector<FreeBlock*> freeLists;  // Free list of every size class, indexed by size / Granularity.
+
+    // Returns the size class of a request.
+    static std::size_t classOf(std::size_t bytes) {
+        return (std::max(bytes, sizeof(FreeBlock)) + Granularity - 1) / Granularity;
+    }
+
+public:
+    // Constructor creates an empty pool.
+    NodePool() : freeLists(MaxBlockBytes / Granularity + 1, nullptr) {}
+
+    // The pool owns its arena, so it can be neither copied nor moved.
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Returns a block of at least the given bytes. Over-aligned requests bypass the pool for the aligned operator new.
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        if (alignment > Granularity) {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+        if (bytes > MaxBlockBytes) {
+            return ::operator new(bytes);
+        }
+        std::size_t sizeClass = classOf(bytes);
+        FreeBlock* block = freeLists[sizeClass];
+        if (block != nullptr) {
+            freeLists[sizeClass] = block->next;
+            return block;
+        }
+        return arena.allocate(sizeClass * Granularity, Granularity);
+    }
+
+    // Returns a block to its size class's free list.
+    void deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+        if (alignment > Granularity) {
+            ::operator delete(pointer, std::align_val_t(alignment));
+            return;
+        }
+        if (bytes > MaxBlockBytes) {
+            ::operator delete(pointer);
+            return;
+        }
+        std::size_t sizeClass = classOf(bytes);
+        FreeBlock* block = static_cast<FreeBlock*>(pointer);
+        block->next = freeLists[sizeClass];
+        freeLists[sizeClass] = block;
+    }
+
+    // Frees every pooled block at once, invalidating them, in time proportional to the number of arena chunks.
+    void release() {
+        arena.release();
+        std::fill(freeLists.begin(), freeLists.end(), nullptr);
+    }
+
+    // Returns the number of bytes the pool holds for pooled blocks, free ones included.
+    std::size_t bytesReserved() const {
+        return arena.bytesReserved();
+    }
+};
+
+// Standard allocator drawing from an Arena or NodePool. Copies, including those rebound to another type by a
+// container, share the resource and compare equal exactly when they do.
+template <typename T, typename Resource>
+class ResourceAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    Resource* resource; // Resource every allocation is drawn from.
+
+    // Constructor binds the allocator to a resource.
+    explicit ResourceAllocator(Resource& resource) : resource(&resource) {}
+
+    // Converting constructor used by containers to rebind the allocator to their node type.
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U, Resource>& other) : resource(other.resource) {}
+
+    // Allocates room for count objects of type T.
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Returns room for count objects of type T.
+    void deallocate(T* pointer, std::size_t count) {
+        resource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ResourceAllocator<U, Resource>& other) const {
+        return resource == other.resource;
+    }
+
+    template <typename U>
+    bool operator!=(const ResourceAllocator<U, Resource>& other) const {
+        return resource != other.resource;
+    }
+};
+
+// Allocator drawing from an Arena.
+template <typename T>
+using ArenaAllocator = ResourceAllocator<T, Arena>;
+
+// Allocator drawing from a NodePool.
+template <typename T>
+using PoolAllocator = ResourceAllocator<T, NodePool>;
+
+// Trait marking allocators whose memory is reclaimed as a whole by the resource, so a container of trivially
+// destructible elements may forget its nodes in O(1) instead of deallocating them one by one.
+template <typename Allocator>
+struct ReleasesInBulk : std::false_type {};
+
+template <typename T>
+struct ReleasesInBulk<ArenaAllocator<T>> : std::true_type {};
+
+#endif // NODEALLOCATOR_H
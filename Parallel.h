@@ -0,0 +1,162 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+// Threading helpers shared by the parallel importers, generators and algorithms.
+
+// Resolves a requested thread count, where zero or less means one thread per hardware thread.
+inline int resolveThreadCount(int numThreads) {
+    return numThreads > 0 ? numThreads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+// Runs body(thread) on numThreads threads, the calling thread included, and rethrows the first exception.
+template <typename Function>
+void runParallel(int numThreads, Function body) {
+    std::vector<std::exception_ptr> failures(numThreads);
+    auto guarded = [&body, &failures](int thread) {
+        try {
+            body(thread);
+        } catch (...) {
+            failures[thread] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> helpers;
+    for (int thread = 1; thread < numThreads; ++thread) {
+        helpers.emplace_back(guarded, thread);
+    }
+    guarded(0);
+    for (auto& helper : helpers) {
+        helper.join();
+    }
+    for (auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+}
+
+// Team of threads that runs many short parallel steps without starting threads for each one. The caller takes part in
+// every step as thread 0; helper threads are started the first time a step needs them and wait between steps, in the
+// manner of BatchQuery's workers. Suited to algorithms made of many phases, such as delta-stepping.
+class WorkerTeam {
+public:
+    // Constructor creates a team of up to maxThreads threads, the caller included; no thread is started yet.
+    explicit WorkerTeam(int maxThreads)
+        : maxThreads(std::max(1, maxThreads)), step(nullptr), stepThreads(0), activeHelpers(0), stepGeneration(0), stopping(false) {}
+
+    // The team owns running threads, so it can be neither copied nor moved.
+    WorkerTeam(const WorkerTeam&) = delete;
+    WorkerTeam& operator=(const WorkerTeam&) = delete;
+
+    // Destructor stops and joins the helper threads.
+    ~WorkerTeam() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeHelpers.notify_all();
+        for (auto& helper : helpers) {
+            helper.join();
+        }
+    }
+
+    // Returns the largest number of threads a step may use.
+    int size() const {
+        return maxThreads;
+    }
+
+    // Runs body(thread) for every thread in [0, numThreads), clamped to the team size, and rethrows the first exception.
+    // Returns once every thread has finished; a one-thread step runs on the caller alone.
+    void run(int numThreads, const std::function<void(int)>& body) {
+        numThreads = std::min(std::max(1, numThreads), maxThreads);
+        if (numThreads == 1) {
+            body(0);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        while (static_cast<int>(helpers.size()) < numThreads - 1) {
+            helpers.emplace_back(&WorkerTeam::helperLoop, this, static_cast<int>(helpers.size()) + 1, stepGeneration);
+        }
+        step = &body;
+        stepThreads = numThreads;
+        activeHelpers = numThreads - 1;
+        failure = nullptr;
+        ++stepGeneration;
+        lock.unlock();
+        wakeHelpers.notify_all();
+
+        std::exception_ptr ownFailure;
+        try {
+            body(0);
+        } catch (...) {
+            ownFailure = std::current_exception();
+        }
+        lock.lock();
+        stepDone.wait(lock, [this] { return activeHelpers == 0; });
+        step = nullptr;
+        if (ownFailure) {
+            std::rethrow_exception(ownFailure);
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+private:
+    int maxThreads;                               // Largest number of threads in a step, the caller included.
+    std::vector<std::thread> helpers;             // Helper threads; helper i runs as thread i + 1.
+    std::mutex mutex;                             // Guards the fields below.
+    std::condition_variable wakeHelpers;          // Signals a new step or shutdown to the helpers.
+    std::condition_variable stepDone;             // Signals the caller when the last helper finishes a step.
+    const std::function<void(int)>* step;         // Work of the current step.
+    std::exception_ptr failure;                   // First exception thrown by a helper in the current step.
+    int stepThreads;                              // Number of threads taking part in the current step.
+    int activeHelpers;                            // Helpers that have not finished the current step.
+    unsigned int stepGeneration;                  // Incremented for every step so helpers can tell steps apart.
+    bool stopping;                                // Set when the team is being destroyed.
+
+    // Body of each helper thread: wait for a step, run it if this thread takes part, report completion.
+    void helperLoop(int thread, unsigned int seenGeneration) {
+        while (true) {
+            const std::function<void(int)>* body;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wakeHelpers.wait(lock, [this, seenGeneration] { return stopping || stepGeneration != seenGeneration; });
+                if (stopping) {
+                    return;
+                }
+                seenGeneration = stepGeneration;
+                if (thread >= stepThreads) {
+                    continue; // Not needed for this step.
+                }
+                body = step;
+            }
+
+            try {
+                (*body)(thread);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--activeHelpers == 0) {
+                stepDone.notify_one();
+            }
+        }
+    }
+};
+
+#endif // PARALLEL_H
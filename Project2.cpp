@@ -1,8 +1,9 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #include "GraphAdjacencyList.h"
 #include "GraphAdjacencyMatrix.h"
+#include "GraphCSR.h"
 #include "GraphAlgorithm.h"
 #include <iostream>
 
@@ -30,23 +31,35 @@ int main() {
         graphMatrix, numVertices, maxEdges, minWeight, maxWeight);
 
     // Execute Dijkstra's algorithm on both graphs to find the shortest path from the source to the destination vertex.
-    SinglyLinkedList<int> pathList = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::execute(graphList, sourceVertex, destinationVertex);
-    SinglyLinkedList<int> pathMatrix = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::execute(graphMatrix, sourceVertex, destinationVertex);
+    GraphAlgorithm::SSSP::ShortestPath<WeightType> pathList = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::execute(graphList, sourceVertex, destinationVertex);
+    GraphAlgorithm::SSSP::ShortestPath<WeightType> pathMatrix = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::execute(graphMatrix, sourceVertex, destinationVertex);
+
+    // Freeze the adjacency list into an immutable CSR graph and run the same query over its contiguous edge arrays.
+    GraphCSR<VertexType, WeightType> graphCSR(graphList);
+    GraphAlgorithm::SSSP::ShortestPath<WeightType> pathCSR = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::execute(graphCSR, sourceVertex, destinationVertex);
 
     // Output the graph structures and the shortest paths found by Dijkstra's algorithm.
     std::cout << "Adjacency List Graph Representation:" << std::endl;
     graphList.print(); // Display the adjacency list graph.
     std::cout << "Shortest path (Adjacency List) from vertex " << sourceVertex << " to vertex " << destinationVertex << ":" << std::endl;
-    GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::printSSSP<GraphAdjacencyList<VertexType, WeightType>>(
-        graphList, sourceVertex, destinationVertex, pathList); // Print the shortest path for the adjacency list graph.
+    GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::printSSSP(
+        sourceVertex, destinationVertex, pathList); // Print the shortest path for the adjacency list graph.
     
     std::cout << std::endl;
 
     std::cout << "Adjacency Matrix Graph Representation:" << std::endl;
     graphMatrix.print(); // Display the adjacency matrix graph.
     std::cout << "Shortest path (Adjacency Matrix) from vertex " << sourceVertex << " to vertex " << destinationVertex << ":" << std::endl;
-    GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::printSSSP<GraphAdjacencyMatrix<VertexType, WeightType>>(
-        graphMatrix, sourceVertex, destinationVertex, pathMatrix); // Print the shortest path for the adjacency matrix graph.
+    GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::printSSSP(
+        sourceVertex, destinationVertex, pathMatrix); // Print the shortest path for the adjacency matrix graph.
+
+    std::cout << std::endl;
+
+    std::cout << "CSR Graph Representation (frozen from the adjacency list):" << std::endl;
+    graphCSR.print(); // Display the frozen CSR graph.
+    std::cout << "Shortest path (CSR) from vertex " << sourceVertex << " to vertex " << destinationVertex << ":" << std::endl;
+    GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType>::printSSSP(
+        sourceVertex, destinationVertex, pathCSR); // Print the shortest path for the CSR graph.
 
     return 0;
 }
@@ -0,0 +1,276 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include "GraphAlgorithm.h"
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace GraphAlgorithm {
+    // Trait detecting graph types that report a content version, such as the mutable adjacency list and matrix.
+    template <typename GraphType, typename = void>
+    struct HasVersion : std::false_type {};
+
+    template <typename GraphType>
+    struct HasVersion<GraphType, std::void_t<decltype(std::declval<const GraphType&>().version())>> : std::true_type {};
+
+    // Returns the content version of a graph; graphs without one, such as GraphCSR, cannot change and always report 0.
+    template <typename GraphType>
+    unsigned long long versionOf(const GraphType& graph) {
+        if constexpr (HasVersion<GraphType>::value) {
+            return graph.version();
+        } else {
+            return 0;
+        }
+    }
+
+    namespace SSSP {
+
+        // Class caching Dijkstra results for one graph, for workloads that repeat the same source/destination pairs.
+        // Point-to-point paths are kept in one bounded LRU list and, if treeCapacity is nonzero, whole shortest-path
+        // trees in a second one: a miss then searches the whole graph from the source and keeps the tree, so every
+        // later destination from that source is answered without a search.
+        // All entries belong to the graph version they were computed at. The first lookup that sees a new version
+        // drops them all, so a result is never served after addEdge, removeEdge, removeVertex or any other mutation.
+        // Lookups may run on several threads at once; a mutex guards the lists, and searches run outside it, so two
+        // threads missing on the same key both search. Mutating the graph while queries run is not supported, as with
+        // every other algorithm here. The cache holds a reference, so the graph must outlive it.
+        template <typename VertexType, typename WeightType, typename GraphType,
+                  typename QueueType = typename DefaultQueue<WeightType>::type>
+        class QueryCache {
+        public:
+            using Search = Dijkstra<VertexType, WeightType, QueueType>;
+            using Workspace = typename Search::Workspace;
+            using Tree = ShortestPathTree<WeightType>;
+
+            // Constructor creates an empty cache holding up to pathCapacity paths and treeCapacity trees.
+            QueryCache(const GraphType& graph, std::size_t pathCapacity, std::size_t treeCapacity = 0)
+                : graph(graph), pathCapacity(pathCapacity), treeCapacity(treeCapacity), cachedVersion(versionOf(graph)),
+                  numHits(0), numMisses(0), numInvalidations(0) {}
+
+            // The cache guards its lists with a mutex, so it can be neither copied nor moved.
+            QueryCache(const QueryCache&) = delete;
+            QueryCache& operator=(const QueryCache&) = delete;
+
+            // Returns the shortest path from source to destination, from the cache if possible.
+            ShortestPath<WeightType> execute(int source, int destination) {
+                return lookup(source, destination, nullptr);
+            }
+
+            // Returns the shortest path from source to destination, searching with the caller's workspace on a miss.
+            ShortestPath<WeightType> execute(int source, int destination, Workspace& workspace) {
+                return lookup(source, destination, &workspace);
+            }
+
+            // Returns the full shortest-path tree from a source, from the cache if possible.
+            // The tree is shared and immutable, so it stays valid after eviction for as long as the caller holds it.
+            std::shared_ptr<const Tree> shortestPathTree(int source) {
+                checkVertex(source);
+                unsigned long long version = versionOf(graph);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    synchronize(version);
+                    if (std::shared_ptr<const Tree> tree = findTree(source)) {
+                        numHits.fetch_add(1, std::memory_order_relaxed);
+                        return tree;
+                    }
+                }
+
+                numMisses.fetch_add(1, std::memory_order_relaxed);
+                std::shared_ptr<const Tree> tree = std::make_shared<const Tree>(Search::shortestPathTree(graph, source));
+                std::lock_guard<std::mutex> lock(mutex);
+                if (version == cachedVersion) {
+                    insert(trees, treeOrder, treeCapacity, static_cast<std::uint64_t>(source), tree);
+                }
+                return tree;
+            }
+
+            // Drops every cached entry; the counters are kept.
+            void clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                dropAll();
+            }
+
+            // Returns the number of lookups answered from the cache.
+            std::uint64_t hits() const {
+                return numHits.load(std::memory_order_relaxed);
+            }
+
+            // Returns the number of lookups that had to search.
+            std::uint64_t misses() const {
+                return numMisses.load(std::memory_order_relaxed);
+            }
+
+            // Returns the number of times a graph mutation emptied the cache.
+            std::uint64_t invalidations() const {
+                return numInvalidations.load(std::memory_order_relaxed);
+            }
+
+            // Returns the number of cached paths.
+            std::size_t pathCount() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return paths.size();
+            }
+
+            // Returns the number of cached trees.
+            std::size_t treeCount() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return trees.size();
+            }
+
+        private:
+            // Entries of an LRU list, most recently used first, and the index from key to list position.
+            template <typename ValueType>
+            using LruList = std::list<std::pair<std::uint64_t, ValueType>>;
+            template <typename ValueType>
+            using LruIndex = std::unordered_map<std::uint64_t, typename LruList<ValueType>::iterator>;
+
+            const GraphType& graph;                          // Graph the results belong to.
+            std::size_t pathCapacity;                        // Largest number of cached paths.
+            std::size_t treeCapacity;                        // Largest number of cached trees; zero disables trees.
+            std::mutex mutex;                                // Guards the fields below.
+            unsigned long long cachedVersion;                // Graph version of every cached entry.
+            LruList<ShortestPath<WeightType>> pathOrder;     // Cached paths keyed by source and destination.
+            LruIndex<ShortestPath<WeightType>> paths;        // Index into pathOrder.
+            LruList<std::shared_ptr<const Tree>> treeOrder;  // Cached trees keyed by source.
+            LruIndex<std::shared_ptr<const Tree>> trees;     // Index into treeOrder.
+            std::atomic<std::uint64_t> numHits;              // Lookups answered from the cache.
+            std::atomic<std::uint64_t> numMisses;            // Lookups that searched.
+            std::atomic<std::uint64_t> numInvalidations;     // Version changes that emptied the cache.
+
+            // Answers one point-to-point query, searching with the given workspace on a miss, or without one if it is null.
+            ShortestPath<WeightType> lookup(int source, int destination, Workspace* workspace) {
+                checkVertex(source);
+                checkVertex(destination);
+                unsigned long long version = versionOf(graph);
+                std::uint64_t key = pairKey(source, destination);
+                std::shared_ptr<const Tree> tree;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    synchronize(version);
+                    auto path = paths.find(key);
+                    if (path != paths.end()) {
+                        pathOrder.splice(pathOrder.begin(), pathOrder, path->second);
+                        numHits.fetch_add(1, std::memory_order_relaxed);
+                        return path->second->second;
+                    }
+                    tree = findTree(source);
+                }
+                if (tree) {
+                    numHits.fetch_add(1, std::memory_order_relaxed);
+                    return pathFromTree(*tree, destination);
+                }
+
+                numMisses.fetch_add(1, std::memory_order_relaxed);
+                ShortestPath<WeightType> result;
+                if (treeCapacity > 0) {
+                    tree = std::make_shared<const Tree>(Search::shortestPathTree(graph, source));
+                    result = pathFromTree(*tree, destination);
+                } else {
+                    result = workspace ? Search::execute(graph, source, destination, *workspace) : Search::execute(graph, source, destination);
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                // A result computed before a version change must not be stored under the new version.
+                if (version == cachedVersion) {
+                    if (tree) {
+                        insert(trees, treeOrder, treeCapacity, static_cast<std::uint64_t>(source), tree);
+                    }
+                    insert(paths, pathOrder, pathCapacity, key, result);
+                }
+                return result;
+            }
+
+            // Throws if a vertex index is outside the graph.
+            void checkVertex(int vertex) const {
+                if (vertex < 0 || vertex >= graph.vertexCount()) {
+                    throw std::out_of_range("Query vertex out of range");
+                }
+            }
+
+            // Combines a source and destination into one key.
+            static std::uint64_t pairKey(int source, int destination) {
+                return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(source)) << 32) | static_cast<std::uint32_t>(destination);
+            }
+
+            // Drops every entry if the graph has changed since they were computed. Called with the mutex held.
+            void synchronize(unsigned long long version) {
+                if (version != cachedVersion) {
+                    dropAll();
+                    cachedVersion = version;
+                    numInvalidations.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            // Empties both lists. Called with the mutex held.
+            void dropAll() {
+                pathOrder.clear();
+                paths.clear();
+                treeOrder.clear();
+                trees.clear();
+            }
+
+            // Returns the cached tree of a source, marking it most recently used, or null. Called with the mutex held.
+            std::shared_ptr<const Tree> findTree(int source) {
+                auto tree = trees.find(static_cast<std::uint64_t>(source));
+                if (tree == trees.end()) {
+                    return nullptr;
+                }
+                treeOrder.splice(treeOrder.begin(), treeOrder, tree->second);
+                return tree->second->second;
+            }
+
+            // Stores a value as the most recently used entry, evicting the least recently used one when full.
+            // An entry another thread stored meanwhile is replaced. Called with the mutex held.
+            template <typename ValueType>
+            static void insert(LruIndex<ValueType>& index, LruList<ValueType>& order, std::size_t capacity, std::uint64_t key,
+                               const ValueType& value) {
+                if (capacity == 0) {
+                    return;
+                }
+                auto existing = index.find(key);
+                if (existing != index.end()) {
+                    existing->second->second = value;
+                    order.splice(order.begin(), order, existing->second);
+                    return;
+                }
+                if (order.size() == capacity) {
+                    index.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(key, value);
+                index.emplace(key, order.begin());
+            }
+
+            // Reads the path to a destination out of a shortest-path tree.
+            static ShortestPath<WeightType> pathFromTree(const Tree& tree, int destination) {
+                ShortestPath<WeightType> path;
+                if (tree.distances[destination] == std::numeric_limits<WeightType>::max()) {
+                    return path;
+                }
+                path.reachable = true;
+                path.totalWeight = tree.distances[destination];
+                std::size_t length = 0;
+                for (int at = destination; at != -1; at = tree.previous[at]) {
+                    ++length;
+                }
+                path.vertices.resize(length);
+                for (int at = destination; at != -1; at = tree.previous[at]) {
+                    path.vertices[--length] = at;
+                }
+                return path;
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // QUERYCACHE_H
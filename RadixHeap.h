@@ -0,0 +1,162 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <vector>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+// A template class RadixHeap implementing a monotone radix heap for non-negative integral keys.
+// Bucket 0 holds ids whose key equals the last extracted key; bucket b > 0 holds ids whose key first differs from it
+// in bit b - 1. Extraction refills bucket 0 by redistributing the lowest non-empty bucket, so each id moves to a
+// lower bucket at most once per bit and the amortized cost per operation is O(log C) without any key comparisons.
+// Each id is stored at most once, and decreaseKey moves it between buckets in O(1).
+template <typename Key>
+class RadixHeap {
+    static_assert(std::is_integral<Key>::value, "RadixHeap requires an integral key type");
+
+private:
+    using UnsignedKey = typename std::make_unsigned<Key>::type;
+    static constexpr int NumBuckets = std::numeric_limits<UnsignedKey>::digits + 1;
+
+    std::vector<int> buckets[NumBuckets]; // Bucket b holds ids whose key differs from last in its highest bit b - 1.
+    std::vector<UnsignedKey> keys;        // Current key of each queued id.
+    std::vector<int> bucketIndex;         // Bucket holding each id, or -1 if the id is not queued.
+    std::vector<int> slot;                // Index of each id within its bucket.
+    UnsignedKey last;                     // The last extracted key; every queued key is at least this value.
+    int count;                            // Number of queued ids.
+
+    // Returns the bucket for a key: the position of the highest bit in which it differs from last.
+    int bucketOf(UnsignedKey key) const {
+        UnsignedKey diff = key ^ last;
+        if (diff == 0) {
+            return 0;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return std::numeric_limits<unsigned long long>::digits - __builtin_clzll(static_cast<unsigned long long>(diff));
+#else
+        int bits = 0;
+        while (diff != 0) {
+            ++bits;
+            diff >>= 1;
+        }
+        return bits;
+#endif
+    }
+
+    // Removes an id from its bucket by moving the bucket's last id into its slot.
+    void unlink(int id) {
+        std::vector<int>& bucket = buckets[bucketIndex[id]];
+        int moved = bucket.back();
+        bucket[slot[id]] = moved;
+        slot[moved] = slot[id];
+        bucket.pop_back();
+        bucketIndex[id] = -1;
+    }
+
+    // Appends an id to the bucket matching its current key.
+    void link(int id) {
+        int b = bucketOf(keys[id]);
+        bucketIndex[id] = b;
+        slot[id] = static_cast<int>(buckets[b].size());
+        buckets[b].push_back(id);
+    }
+
+public:
+    // Constructor initializes an empty heap.
+    RadixHeap() : last(0), count(0) {}
+
+    // Empties the heap and makes room for ids in [0, capacity).
+    // Only the ids still in the heap are touched, so resetting after a partial search is cheap.
+    void reset(int capacity) {
+        for (auto& bucket : buckets) {
+            for (int id : bucket) {
+                bucketIndex[id] = -1;
+            }
+            bucket.clear();
+        }
+        last = 0;
+        count = 0;
+        if (static_cast<int>(bucketIndex.size()) < capacity) {
+            bucketIndex.resize(capacity, -1);
+            slot.resize(capacity);
+            keys.resize(capacity);
+        }
+    }
+
+    // Checks if an id is currently queued.
+    bool contains(int id) const {
+        return id >= 0 && id < static_cast<int>(bucketIndex.size()) && bucketIndex[id] != -1;
+    }
+
+    // Inserts the id, or lowers its key if it is already queued.
+    // Keys must be non-negative and not smaller than the last extracted key.
+    void push(int id, Key key) {
+        if (id < 0 || id >= static_cast<int>(bucketIndex.size())) {
+            throw std::out_of_range("Heap id out of range");
+        }
+        if (key < 0 || static_cast<UnsignedKey>(key) < last) {
+            throw std::invalid_argument("Key is smaller than the last extracted key");
+        }
+        if (bucketIndex[id] != -1) {
+            if (!(static_cast<UnsignedKey>(key) < keys[id])) {
+                return; // Not an improvement; keep the current key.
+            }
+            unlink(id);
+            --count;
+        }
+        keys[id] = static_cast<UnsignedKey>(key);
+        link(id);
+        ++count;
+    }
+
+    // Extracts the id with the minimum key as a (key, id) pair.
+    std::pair<Key, int> extractMin() {
+        if (count == 0) {
+            throw std::range_error("Heap is empty"); // Safety check.
+        }
+        if (buckets[0].empty()) {
+            // Find the lowest non-empty bucket and make its smallest key the new last.
+            int b = 1;
+            while (buckets[b].empty()) {
+                ++b;
+            }
+            UnsignedKey minKey = keys[buckets[b][0]];
+            for (int id : buckets[b]) {
+                if (keys[id] < minKey) {
+                    minKey = keys[id];
+                }
+            }
+            last = minKey;
+            // Every id in the bucket now falls into a strictly lower bucket.
+            std::vector<int> moving;
+            moving.swap(buckets[b]);
+            for (int id : moving) {
+                link(id);
+            }
+            moving.clear();
+            moving.swap(buckets[b]); // Hand the emptied buffer back so its capacity is reused.
+        }
+        int id = buckets[0].back();
+        buckets[0].pop_back();
+        bucketIndex[id] = -1;
+        --count;
+        return {static_cast<Key>(last), id};
+    }
+
+    // Checks if the heap is empty.
+    bool isEmpty() const {
+        return count == 0;
+    }
+
+    // Returns the number of queued ids.
+    int size() const {
+        return count;
+    }
+};
+
+#endif // RADIXHEAP_H
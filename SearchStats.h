@@ -0,0 +1,196 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <utility>
+#include <ostream>
+#include <algorithm>
+
+namespace GraphAlgorithm {
+    namespace SSSP {
+
+        // Statistics sink policies for the searches. A search calls the hooks below at its hot points; with NoStats every
+        // hook is an empty inline function, so an uninstrumented search compiles to the same code as before.
+        //   beginQuery(), endQuery()          bracket one query and time it
+        //   pushed(queueSize)                 a vertex was pushed or had its key lowered; queueSize is the size afterwards
+        //   popped(), stalePopped()           a queue entry was extracted, and whether it was a stale, already settled one
+        //   settled()                         a vertex's distance became final
+        //   relaxed(improved)                 an edge was examined, and whether it lowered its target's distance
+        //   beginNeighbors(), endNeighbors()  bracket fetching a vertex's neighbors
+        //   beginPath(), endPath()            bracket building the result path
+
+        // Statistics sink that records nothing.
+        struct NoStats {
+            static constexpr bool enabled = false;
+
+            void beginQuery() {}
+            void endQuery() {}
+            void pushed(int) {}
+            void popped() {}
+            void stalePopped() {}
+            void settled() {}
+            void relaxed(bool) {}
+            void beginNeighbors() {}
+            void endNeighbors() {}
+            void beginPath() {}
+            void endPath() {}
+        };
+
+        // Statistics sink that counts search effort and times the phases of every query.
+        // Values accumulate over all queries until reset(); sinks of several workers or runs are combined with +=.
+        // For one query's figures, use a fresh sink or take the difference of two snapshots.
+        class SearchStats {
+        public:
+            static constexpr bool enabled = true;
+
+            std::uint64_t queries = 0;        // Queries run.
+            std::uint64_t pushes = 0;         // Queue pushes, decrease-key operations included.
+            std::uint64_t pops = 0;           // Queue extractions.
+            std::uint64_t stalePops = 0;      // Extractions skipped because the vertex was already settled.
+            std::uint64_t settledVertices = 0; // Vertices settled.
+            std::uint64_t relaxations = 0;    // Edges examined.
+            std::uint64_t improvements = 0;   // Relaxations that lowered a tentative distance.
+            std::uint64_t maxQueueSize = 0;   // Largest queue size seen by any query.
+            std::uint64_t searchNanos = 0;    // Time between beginQuery and endQuery.
+            std::uint64_t neighborNanos = 0;  // Time spent fetching neighbor lists, part of searchNanos.
+            std::uint64_t pathNanos = 0;      // Time spent building result paths.
+
+            void beginQuery() {
+                ++queries;
+                queryStart = Clock::now();
+            }
+
+            void endQuery() {
+                searchNanos += elapsedNanos(queryStart);
+            }
+
+            void pushed(int queueSize) {
+                ++pushes;
+                maxQueueSize = std::max(maxQueueSize, static_cast<std::uint64_t>(queueSize));
+            }
+
+            void popped() {
+                ++pops;
+            }
+
+            void stalePopped() {
+                ++stalePops;
+            }
+
+            void settled() {
+                ++settledVertices;
+            }
+
+            void relaxed(bool improved) {
+                ++relaxations;
+                improvements += improved;
+            }
+
+            void beginNeighbors() {
+                phaseStart = Clock::now();
+            }
+
+            void endNeighbors() {
+                neighborNanos += elapsedNanos(phaseStart);
+            }
+
+            void beginPath() {
+                phaseStart = Clock::now();
+            }
+
+            void endPath() {
+                pathNanos += elapsedNanos(phaseStart);
+            }
+
+            // Clears every counter and timer.
+            void reset() {
+                *this = SearchStats();
+            }
+
+            // Adds another sink's values to this one; maxQueueSize takes the larger of the two.
+            SearchStats& operator+=(const SearchStats& other) {
+                queries += other.queries;
+                pushes += other.pushes;
+                pops += other.pops;
+                stalePops += other.stalePops;
+                settledVertices += other.settledVertices;
+                relaxations += other.relaxations;
+                improvements += other.improvements;
+                maxQueueSize = std::max(maxQueueSize, other.maxQueueSize);
+                searchNanos += other.searchNanos;
+                neighborNanos += other.neighborNanos;
+                pathNanos += other.pathNanos;
+                return *this;
+            }
+
+            // Writes the values as one JSON object, with times in seconds.
+            void writeJson(std::ostream& out) const {
+                out << "{\"queries\": " << queries << ", \"pushes\": " << pushes << ", \"pops\": " << pops
+                    << ", \"stale_pops\": " << stalePops << ", \"settled\": " << settledVertices << ", \"relaxations\": " << relaxations
+                    << ", \"improvements\": " << improvements << ", \"max_queue_size\": " << maxQueueSize
+                    << ", \"search_seconds\": " << seconds(searchNanos) << ", \"neighbor_seconds\": " << seconds(neighborNanos)
+                    << ", \"path_seconds\": " << seconds(pathNanos) << "}";
+            }
+
+            // Writes the values in the Prometheus text exposition format. Metric names start with prefix, and labels, if
+            // given, is placed inside the braces of every sample, for example: backend="csr",queue="default".
+            void writePrometheus(std::ostream& out, const std::string& prefix = "sssp", const std::string& labels = "") const {
+                writePrometheusSeries(out, {{labels, *this}}, prefix);
+            }
+
+            // Writes several labelled sinks in the Prometheus text exposition format, grouping the samples of each metric
+            // under one help and type line as the format requires. Each entry pairs a label string with its sink.
+            static void writePrometheusSeries(std::ostream& out, const std::vector<std::pair<std::string, SearchStats>>& series,
+                                              const std::string& prefix = "sssp") {
+                // Writes one metric's help and type lines followed by its sample from every sink.
+                auto metric = [&](const char* name, const char* type, const char* help, auto value) {
+                    out << "# HELP " << prefix << '_' << name << ' ' << help << '\n'
+                        << "# TYPE " << prefix << '_' << name << ' ' << type << '\n';
+                    for (const auto& entry : series) {
+                        out << prefix << '_' << name;
+                        if (!entry.first.empty()) {
+                            out << '{' << entry.first << '}';
+                        }
+                        out << ' ' << value(entry.second) << '\n';
+                    }
+                };
+                metric("queries_total", "counter", "Queries run.", [](const SearchStats& s) { return s.queries; });
+                metric("queue_pushes_total", "counter", "Priority queue pushes, decrease-key included.", [](const SearchStats& s) { return s.pushes; });
+                metric("queue_pops_total", "counter", "Priority queue extractions.", [](const SearchStats& s) { return s.pops; });
+                metric("queue_stale_pops_total", "counter", "Extractions of already settled vertices.", [](const SearchStats& s) { return s.stalePops; });
+                metric("settled_vertices_total", "counter", "Vertices settled.", [](const SearchStats& s) { return s.settledVertices; });
+                metric("relaxations_total", "counter", "Edges examined.", [](const SearchStats& s) { return s.relaxations; });
+                metric("improvements_total", "counter", "Relaxations that lowered a tentative distance.", [](const SearchStats& s) { return s.improvements; });
+                metric("queue_size_max", "gauge", "Largest priority queue size seen.", [](const SearchStats& s) { return s.maxQueueSize; });
+                metric("search_seconds_total", "counter", "Time spent in searches.", [](const SearchStats& s) { return seconds(s.searchNanos); });
+                metric("neighbor_seconds_total", "counter", "Time spent fetching neighbor lists.", [](const SearchStats& s) { return seconds(s.neighborNanos); });
+                metric("path_seconds_total", "counter", "Time spent building result paths.", [](const SearchStats& s) { return seconds(s.pathNanos); });
+            }
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            Clock::time_point queryStart; // Start of the current query.
+            Clock::time_point phaseStart; // Start of the current neighbor fetch or path build.
+
+            // Returns the nanoseconds elapsed since start.
+            static std::uint64_t elapsedNanos(Clock::time_point start) {
+                return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+            }
+
+            // Converts nanoseconds to seconds.
+            static double seconds(std::uint64_t nanos) {
+                return nanos / 1e9;
+            }
+        };
+
+    } // namespace SSSP
+} // namespace GraphAlgorithm
+
+#endif // SEARCHSTATS_H
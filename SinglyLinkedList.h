@@ -1,13 +1,18 @@
 // Author: Trevor Arcieri
-// Last Modified: 6/9/24
+// Last Modified: 10/16/26
 
 #ifndef SINGLYLINKEDLIST_H
 #define SINGLYLINKEDLIST_H
 
+#include "NodeAllocator.h"
 #include <iostream>
+#include <memory>
+#include <type_traits>
 
 // Template class for a singly linked list.
-template <typename T>
+// Allocator supplies the nodes; with an ArenaAllocator or PoolAllocator they are carved from shared chunks instead of
+// the heap, and lists of trivially destructible values on an arena are cleared in O(1), leaving the arena to free them.
+template <typename T, typename Allocator = std::allocator<T>>
 class SinglyLinkedList {
 public:
     // Nested structure to represent nodes in the singly linked list.
@@ -19,11 +24,69 @@ public:
         Node(T val) : data(val), next(nullptr) {}
     };
 
+private:
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    NodeAllocator allocator; // Source of the list's nodes.
+
+    // Allocates and constructs a node holding a value.
+    Node* createNode(const T& val) {
+        Node* node = NodeTraits::allocate(allocator, 1);
+        NodeTraits::construct(allocator, node, val);
+        return node;
+    }
+
+    // Destroys and frees a node.
+    void destroyNode(Node* node) {
+        NodeTraits::destroy(allocator, node);
+        NodeTraits::deallocate(allocator, node, 1);
+    }
+
+public:
     Node* head; // Pointer to the first node in the list.
     Node* tail; // Pointer to the last node in the list.
 
-    // Constructor initializes an empty list.
-    SinglyLinkedList() : head(nullptr), tail(nullptr) {}
+    // Constructor initializes an empty list drawing its nodes from the given allocator.
+    explicit SinglyLinkedList(const Allocator& allocator = Allocator()) : allocator(allocator), head(nullptr), tail(nullptr) {}
+
+    // Copy constructor performs a deep copy so that each list owns its own nodes.
+    SinglyLinkedList(const SinglyLinkedList& other)
+        : allocator(NodeTraits::select_on_container_copy_construction(other.allocator)), head(nullptr), tail(nullptr) {
+        for (Node* current = other.head; current != nullptr; current = current->next) {
+            append(current->data);
+        }
+    }
+
+    // Move constructor takes over the other list's nodes, leaving it empty.
+    SinglyLinkedList(SinglyLinkedList&& other) noexcept : allocator(std::move(other.allocator)), head(other.head), tail(other.tail) {
+        other.head = nullptr;
+        other.tail = nullptr;
+    }
+
+    // Copy assignment replaces this list's contents with a deep copy of the other list.
+    SinglyLinkedList& operator=(const SinglyLinkedList& other) {
+        if (this != &other) {
+            clear();
+            for (Node* current = other.head; current != nullptr; current = current->next) {
+                append(current->data);
+            }
+        }
+        return *this;
+    }
+
+    // Move assignment frees this list's nodes and takes over the other list's nodes, together with its allocator.
+    SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            allocator = std::move(other.allocator);
+            head = other.head;
+            tail = other.tail;
+            other.head = nullptr;
+            other.tail = nullptr;
+        }
+        return *this;
+    }
 
     // Destructor to clear the list and prevent memory leaks.
     ~SinglyLinkedList() {
@@ -32,7 +95,7 @@ public:
 
     // Appends a new element to the end of the list.
     void append(T val) {
-        Node* newNode = new Node(val); // Create a new node.
+        Node* newNode = createNode(val); // Create a new node.
         if (tail != nullptr) {
             tail->next = newNode; // Link the new node to the end of the list.
         }
@@ -59,7 +122,7 @@ public:
                         tail = previous; // If removing the last node, update tail.
                     }
                 }
-                delete current; // Free the memory of the node.
+                destroyNode(current); // Free the memory of the node.
                 return true;
             }
             previous = current;
@@ -83,11 +146,17 @@ public:
 
     // Clears the list, freeing all nodes.
     void clear() {
+        // Arena nodes are freed by the arena itself, so there is nothing to visit unless the values need destroying.
+        if constexpr (ReleasesInBulk<NodeAllocator>::value && std::is_trivially_destructible<T>::value) {
+            head = nullptr;
+            tail = nullptr;
+            return;
+        }
         Node* current = head;
         Node* next = nullptr;
         while (current != nullptr) {
             next = current->next; // Store the next node.
-            delete current; // Free the current node.
+            destroyNode(current); // Free the current node.
             current = next; // Move to the next node.
         }
         head = nullptr;
@@ -0,0 +1,465 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef SNAPSHOTGRAPH_H
+#define SNAPSHOTGRAPH_H
+
+#include "Graph.h"
+#include "GraphCSR.h"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <iomanip>
+#include <cmath>
+
+// Template class for SnapshotGraph, a mutable graph whose readers search immutable snapshots while one writer changes it.
+// Vertices are split into blocks of BlockSize consecutive indices, and each block keeps its vertices' edges in CSR form.
+// A snapshot is an array of pointers to blocks. The first mutation of a block after a publish() copies that block, so
+// every other block stays shared with the published snapshots, and publish() makes the writer's blocks the new current
+// snapshot with a single atomic store.
+// Readers neither lock nor write shared counters per query: each thread owns a Reader, which announces the epoch it pins
+// in a slot of its own, and pin() returns the current snapshot. Every publish() advances the epoch and retires the
+// snapshot it replaced, which is freed once no slot shows a reader pinned before that epoch.
+// Only one thread may call the writing side (the Graph interface, updateEdgeWeight, publish and reclaim); mutations stay
+// invisible to readers until the next publish(). Readers may be created, pinned and destroyed on any thread.
+// Removing a vertex also deletes the edges into it, since snapshots keep no tombstones for readers to skip, so it runs in
+// O(V + E); the slot is reused by a later addVertex. Every other mutation costs O(BlockSize + edges of the block).
+template <typename VertexType, typename WeightType>
+class SnapshotGraph : public Graph<VertexType, WeightType> {
+public:
+    static constexpr int BlockShift = 6;                // Log2 of the number of vertices per block.
+    static constexpr int BlockSize = 1 << BlockShift;   // Number of vertices per block.
+    static constexpr int DefaultMaxReaders = 64;        // Reader slots reserved by default.
+
+    using EdgeRange = typename GraphCSR<VertexType, WeightType>::EdgeRange;
+
+private:
+    static constexpr unsigned long long Idle = 0; // Epoch of a slot whose reader holds no snapshot.
+
+    // Epoch announcement of one Reader, padded to a cache line so readers do not contend with each other.
+    struct alignas(64) ReaderSlot {
+        std::atomic<unsigned long long> epoch{Idle}; // Epoch of the pinned snapshot, or Idle.
+        std::atomic<bool> claimed{false};            // Whether a Reader owns the slot.
+    };
+
+    // Vertices and outgoing edges of BlockSize consecutive vertex indices; the last block may hold fewer.
+    struct Block {
+        std::vector<VertexType> vertices; // Vertex of every slot in the block.
+        std::vector<char> removed;        // Whether each slot holds a removed vertex.
+        std::vector<int> offsets;         // Edges of local slot i are at [offsets[i], offsets[i + 1]).
+        std::vector<int> targets;         // Target index of every edge.
+        std::vector<WeightType> weights;  // Weight of every edge.
+
+        // Returns the number of edges of a local slot.
+        int degree(int slot) const {
+            return offsets[slot + 1] - offsets[slot];
+        }
+
+        // Returns the position of the first edge from a local slot to a target, or -1.
+        int find(int slot, int target) const {
+            for (int e = offsets[slot]; e < offsets[slot + 1]; ++e) {
+                if (targets[e] == target) {
+                    return e;
+                }
+            }
+            return -1;
+        }
+
+        // Erases the edges of a local slot that satisfy a predicate and returns how many were erased.
+        template <typename Predicate>
+        int eraseEdges(int slot, Predicate predicate) {
+            int write = offsets[slot];
+            for (int e = offsets[slot]; e < offsets[slot + 1]; ++e) {
+                if (!predicate(targets[e])) {
+                    targets[write] = targets[e];
+                    weights[write] = weights[e];
+                    ++write;
+                }
+            }
+            int erased = offsets[slot + 1] - write;
+            if (erased > 0) {
+                targets.erase(targets.begin() + write, targets.begin() + offsets[slot + 1]);
+                weights.erase(weights.begin() + write, weights.begin() + offsets[slot + 1]);
+                for (std::size_t i = slot + 1; i < offsets.size(); ++i) {
+                    offsets[i] -= erased;
+                }
+            }
+            return erased;
+        }
+    };
+
+public:
+    // Immutable view of the graph as of one publish(). Snapshots satisfy the graph interface the search algorithms
+    // use, so Dijkstra, BatchQuery and the others run on them directly.
+    class Snapshot {
+    public:
+        // Returns the number of vertex slots, removed ones included.
+        int vertexCount() const {
+            return numVertices;
+        }
+
+        // Returns the outgoing edges of a vertex without copying them.
+        EdgeRange edges(int vertex) const {
+            const Block& block = *blocks[vertex >> BlockShift];
+            int slot = vertex & (BlockSize - 1);
+            int first = block.offsets[slot];
+            return EdgeRange(block.targets.data() + first, block.weights.data() + first, block.degree(slot));
+        }
+
+        // Returns the outgoing edges of a vertex as (neighbor index, weight) pairs.
+        std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const {
+            std::vector<std::pair<int, WeightType>> neighbors;
+            for (const auto& edge : edges(vertex)) {
+                neighbors.push_back(edge);
+            }
+            return neighbors;
+        }
+
+        // Returns the weight of the edge between two vertices.
+        WeightType getEdgeWeight(int fromVertex, int toVertex) const {
+            const Block& block = *blocks[fromVertex >> BlockShift];
+            int e = block.find(fromVertex & (BlockSize - 1), toVertex);
+            if (e == -1) {
+                throw std::range_error("Edge does not exist");
+            }
+            return block.weights[e];
+        }
+
+        // Returns the vertex stored at the given index.
+        VertexType getVertex(int vertexIndex) const {
+            if (vertexIndex < 0 || vertexIndex >= numVertices) {
+                throw std::out_of_range("Vertex index out of range");
+            }
+            return blocks[vertexIndex >> BlockShift]->vertices[vertexIndex & (BlockSize - 1)];
+        }
+
+        // Checks if the vertex at an index had been removed when the snapshot was published.
+        bool isRemoved(int vertexIndex) const {
+            return blocks[vertexIndex >> BlockShift]->removed[vertexIndex & (BlockSize - 1)] != 0;
+        }
+
+        // Returns the version of the graph's contents the snapshot holds; see nextGraphVersion().
+        unsigned long long version() const {
+            return contentVersion;
+        }
+
+    private:
+        friend class SnapshotGraph;
+
+        std::vector<std::shared_ptr<const Block>> blocks; // Blocks of the snapshot, shared with other snapshots.
+        int numVertices;                                   // Number of vertex slots.
+        unsigned long long contentVersion;                 // Graph version the snapshot was published at.
+    };
+
+    // Per-thread handle that pins snapshots. A thread keeps one Reader for as long as it queries the graph; creating one
+    // claims a reader slot, so at most maxReaders may exist at once. A Reader must be destroyed before its graph.
+    class Reader {
+    public:
+        // Constructor claims a free reader slot. Throws std::length_error if every slot is taken.
+        explicit Reader(SnapshotGraph& graph) : graph(graph), slot(nullptr) {
+            for (int i = 0; i < graph.maxReaders; ++i) {
+                bool expected = false;
+                if (graph.slots[i].claimed.compare_exchange_strong(expected, true)) {
+                    slot = &graph.slots[i];
+                    return;
+                }
+            }
+            throw std::length_error("Too many snapshot readers");
+        }
+
+        // A Reader owns its slot, so it can be neither copied nor moved.
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Destructor unpins and frees the slot.
+        ~Reader() {
+            unpin();
+            slot->claimed.store(false);
+        }
+
+        // Returns the current snapshot, which stays valid until the next pin() or unpin() on this Reader.
+        const Snapshot& pin() {
+            // Announce the epoch before reading the snapshot: a writer that reads this slot afterwards keeps every snapshot
+            // retired at a later epoch, and one that read it before will already have stored a newer current snapshot.
+            slot->epoch.store(graph.epoch.load());
+            return *graph.current.load();
+        }
+
+        // Releases the pinned snapshot so that the writer may free it.
+        void unpin() {
+            slot->epoch.store(Idle);
+        }
+
+    private:
+        SnapshotGraph& graph; // Graph the snapshots are pinned from.
+        ReaderSlot* slot;     // Slot announcing this reader's pinned epoch.
+    };
+
+    // Constructor creates an empty graph with room for the given number of concurrent Readers and publishes it.
+    explicit SnapshotGraph(int maxReaders = DefaultMaxReaders)
+        : maxReaders(maxReaders), slots(new ReaderSlot[maxReaders]), current(nullptr), epoch(1), numVertices(0),
+          contentVersion(nextGraphVersion()), changed(true) {
+        if (maxReaders < 1) {
+            throw std::invalid_argument("A snapshot graph needs at least one reader slot");
+        }
+        publish();
+    }
+
+    // Readers hold pointers into the graph, so it can be neither copied nor moved.
+    SnapshotGraph(const SnapshotGraph&) = delete;
+    SnapshotGraph& operator=(const SnapshotGraph&) = delete;
+
+    // Destructor frees the current snapshot and every retired one; every Reader must already be gone.
+    virtual ~SnapshotGraph() {
+        delete current.load();
+        for (const auto& entry : retired) {
+            delete entry.first;
+        }
+    }
+
+    // Adds a vertex to the graph and returns its index, reusing the slot of a removed vertex when one is free.
+    int addVertex(VertexType vertex) override {
+        int vertexIndex;
+        if (!freeSlots.empty()) {
+            vertexIndex = freeSlots.back();
+            freeSlots.pop_back();
+            Block& block = writableBlock(vertexIndex);
+            block.vertices[vertexIndex & (BlockSize - 1)] = vertex;
+            block.removed[vertexIndex & (BlockSize - 1)] = 0;
+        } else {
+            vertexIndex = numVertices++;
+            if ((vertexIndex & (BlockSize - 1)) == 0) {
+                blocks.push_back(std::make_shared<Block>());
+                blocks.back()->offsets.push_back(0);
+                writable.push_back(1);
+            }
+            Block& block = writableBlock(vertexIndex);
+            block.vertices.push_back(vertex);
+            block.removed.push_back(0);
+            block.offsets.push_back(block.offsets.back()); // The new slot starts with no edges.
+        }
+        modified();
+        return vertexIndex;
+    }
+
+    // Removes a vertex, its outgoing edges and every edge into it. Other indices do not change.
+    void removeVertex(int vertexIndex) override {
+        checkVertex(vertexIndex);
+        auto isRemovedVertex = [vertexIndex](int target) { return target == vertexIndex; };
+        for (std::size_t b = 0; b < blocks.size(); ++b) {
+            const Block& block = *blocks[b];
+            // Only blocks that hold an edge into the vertex are copied.
+            if (std::find(block.targets.begin(), block.targets.end(), vertexIndex) == block.targets.end()) {
+                continue;
+            }
+            Block& target = writableBlock(static_cast<int>(b) << BlockShift);
+            for (int slot = 0; slot < static_cast<int>(target.vertices.size()); ++slot) {
+                target.eraseEdges(slot, isRemovedVertex);
+            }
+        }
+        Block& block = writableBlock(vertexIndex);
+        block.eraseEdges(vertexIndex & (BlockSize - 1), [](int) { return true; });
+        block.removed[vertexIndex & (BlockSize - 1)] = 1;
+        freeSlots.push_back(vertexIndex);
+        modified();
+    }
+
+    // Adds an edge between two specified vertices with a given weight.
+    void addEdge(int fromVertex, int toVertex, WeightType weight) override {
+        checkVertex(fromVertex);
+        checkVertex(toVertex);
+        Block& block = writableBlock(fromVertex);
+        int slot = fromVertex & (BlockSize - 1);
+        int end = block.offsets[slot + 1];
+        block.targets.insert(block.targets.begin() + end, toVertex);
+        block.weights.insert(block.weights.begin() + end, weight);
+        for (std::size_t i = slot + 1; i < block.offsets.size(); ++i) {
+            ++block.offsets[i];
+        }
+        modified();
+    }
+
+    // Removes every edge between two specified vertices.
+    void removeEdge(int fromVertex, int toVertex) override {
+        checkVertex(fromVertex);
+        int slot = fromVertex & (BlockSize - 1);
+        if (blockOf(fromVertex).find(slot, toVertex) == -1) {
+            return; // Nothing to remove, so the block stays shared.
+        }
+        writableBlock(fromVertex).eraseEdges(slot, [toVertex](int target) { return target == toVertex; });
+        modified();
+    }
+
+    // Sets the weight of the edge between two specified vertices, or of every such edge if there are several.
+    void updateEdgeWeight(int fromVertex, int toVertex, WeightType weight) {
+        checkVertex(fromVertex);
+        int slot = fromVertex & (BlockSize - 1);
+        if (blockOf(fromVertex).find(slot, toVertex) == -1) {
+            throw std::range_error("Edge does not exist");
+        }
+        Block& block = writableBlock(fromVertex);
+        for (int e = block.offsets[slot]; e < block.offsets[slot + 1]; ++e) {
+            if (block.targets[e] == toVertex) {
+                block.weights[e] = weight;
+            }
+        }
+        modified();
+    }
+
+    // Retrieves the writer's view of the neighbors of a vertex, unpublished changes included.
+    std::vector<std::pair<int, WeightType>> getNeighbors(int vertex) const override {
+        const Block& block = blockOf(vertex);
+        int slot = vertex & (BlockSize - 1);
+        std::vector<std::pair<int, WeightType>> neighbors;
+        neighbors.reserve(block.degree(slot));
+        for (int e = block.offsets[slot]; e < block.offsets[slot + 1]; ++e) {
+            neighbors.emplace_back(block.targets[e], block.weights[e]);
+        }
+        return neighbors;
+    }
+
+    // Retrieves the writer's view of the weight of an edge between two specified vertices.
+    WeightType getEdgeWeight(int fromVertex, int toVertex) const override {
+        const Block& block = blockOf(fromVertex);
+        int e = block.find(fromVertex & (BlockSize - 1), toVertex);
+        if (e == -1) {
+            throw std::range_error("Edge does not exist");
+        }
+        return block.weights[e];
+    }
+
+    // Returns the vertex stored at the given index.
+    VertexType getVertex(int vertexIndex) const override {
+        if (vertexIndex < 0 || vertexIndex >= numVertices) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return blockOf(vertexIndex).vertices[vertexIndex & (BlockSize - 1)];
+    }
+
+    // Checks if the vertex at an index has been removed.
+    bool isRemoved(int vertexIndex) const {
+        return blockOf(vertexIndex).removed[vertexIndex & (BlockSize - 1)] != 0;
+    }
+
+    // Returns the number of vertex slots, removed ones included.
+    int vertexCount() const override {
+        return numVertices;
+    }
+
+    // Returns the version of the writer's contents, which changes with every mutation.
+    unsigned long long version() const {
+        return contentVersion;
+    }
+
+    // Makes every mutation since the last publish visible to later pins, then frees the retired snapshots that no reader
+    // can still hold. Costs O(V / BlockSize) on top of the blocks copied since the last publish; does nothing if the graph
+    // has not changed.
+    void publish() {
+        if (!changed) {
+            return;
+        }
+        Snapshot* snapshot = new Snapshot();
+        snapshot->blocks.assign(blocks.begin(), blocks.end());
+        snapshot->numVertices = numVertices;
+        snapshot->contentVersion = contentVersion;
+        // Published blocks are shared from now on, so the next mutation of each must copy it first.
+        std::fill(writable.begin(), writable.end(), 0);
+        changed = false;
+
+        Snapshot* previous = current.exchange(snapshot);
+        if (previous != nullptr) {
+            // Readers that announce this epoch or a later one read current after the exchange, so they cannot see previous.
+            retired.emplace_back(previous, epoch.fetch_add(1) + 1);
+        }
+        reclaim();
+    }
+
+    // Frees the retired snapshots that every reader has moved past and returns how many remain retired.
+    std::size_t reclaim() {
+        unsigned long long oldest = std::numeric_limits<unsigned long long>::max(); // Earliest epoch a reader has pinned.
+        for (int i = 0; i < maxReaders; ++i) {
+            unsigned long long pinned = slots[i].epoch.load();
+            if (pinned != Idle) {
+                oldest = std::min(oldest, pinned);
+            }
+        }
+        // A snapshot retired at an epoch no later than every pinned one was replaced before those readers pinned.
+        auto reclaimable = std::partition(retired.begin(), retired.end(),
+                                          [oldest](const std::pair<Snapshot*, unsigned long long>& entry) { return entry.second > oldest; });
+        for (auto it = reclaimable; it != retired.end(); ++it) {
+            delete it->first;
+        }
+        retired.erase(reclaimable, retired.end());
+        return retired.size();
+    }
+
+    // Returns the number of retired snapshots waiting for readers to move on.
+    std::size_t retiredCount() const {
+        return retired.size();
+    }
+
+    // Prints the writer's view of the graph along with vertex identifiers.
+    void print() const override {
+        std::cout << "Graph (Snapshot Block Representation):" << std::endl;
+        for (int i = 0; i < numVertices; ++i) {
+            if (isRemoved(i)) {
+                continue;
+            }
+            std::cout << getVertex(i) << " -> ";
+            for (const auto& edge : getNeighbors(i)) {
+                std::cout << "(" << getVertex(edge.first) << ", " << std::fixed << std::setprecision(1) << round(edge.second * 10) / 10 << ") ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+private:
+    int maxReaders;                                // Number of reader slots.
+    std::unique_ptr<ReaderSlot[]> slots;           // Epoch announcement of every Reader.
+    std::atomic<Snapshot*> current;                // Most recently published snapshot.
+    std::atomic<unsigned long long> epoch;         // Advanced by every publish; starts at 1 so that 0 can mean Idle.
+    std::vector<std::pair<Snapshot*, unsigned long long>> retired; // Replaced snapshots and the epoch they were retired at.
+
+    std::vector<std::shared_ptr<Block>> blocks;    // Writer's blocks, unpublished changes included.
+    std::vector<char> writable;                    // Whether each block was copied since the last publish.
+    std::vector<int> freeSlots;                    // Removed slots available for reuse by addVertex.
+    int numVertices;                               // Number of vertex slots, removed ones included.
+    unsigned long long contentVersion;             // Version of the writer's contents; see nextGraphVersion().
+    bool changed;                                  // Whether the writer's contents differ from the current snapshot.
+
+    // Returns the writer's block of a vertex for reading.
+    const Block& blockOf(int vertex) const {
+        if (vertex < 0 || vertex >= numVertices) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+        return *blocks[vertex >> BlockShift];
+    }
+
+    // Returns the writer's block of a vertex for writing, copying it first if a published snapshot shares it.
+    Block& writableBlock(int vertex) {
+        int b = vertex >> BlockShift;
+        if (!writable[b]) {
+            blocks[b] = std::make_shared<Block>(*blocks[b]);
+            writable[b] = 1;
+        }
+        return *blocks[b];
+    }
+
+    // Throws unless the index names a vertex that has not been removed.
+    void checkVertex(int vertexIndex) const {
+        if (blockOf(vertexIndex).removed[vertexIndex & (BlockSize - 1)]) {
+            throw std::out_of_range("Vertex has been removed");
+        }
+    }
+
+    // Records that the writer's contents changed.
+    void modified() {
+        contentVersion = nextGraphVersion();
+        changed = true;
+    }
+};
+
+#endif // SNAPSHOTGRAPH_H
@@ -0,0 +1,367 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef VERTEXREORDERING_H
+#define VERTEXREORDERING_H
+
+#include "GraphCSR.h"
+#include "GraphAlgorithm.h"
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <stdexcept>
+
+// A relabelling of vertex ids: newIds[old] is the new id of an old vertex and oldIds[new] the old id of a new one.
+struct VertexPermutation {
+    std::vector<int> newIds; // New id of every old id.
+    std::vector<int> oldIds; // Old id of every new id.
+
+    // Builds the permutation that gives the i-th vertex of order the new id i; order must list every vertex once.
+    static VertexPermutation fromOrder(std::vector<int> order) {
+        VertexPermutation permutation;
+        permutation.newIds.assign(order.size(), -1);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            if (order[i] < 0 || order[i] >= static_cast<int>(order.size()) || permutation.newIds[order[i]] != -1) {
+                throw std::invalid_argument("Vertex order is not a permutation");
+            }
+            permutation.newIds[order[i]] = static_cast<int>(i);
+        }
+        permutation.oldIds = std::move(order);
+        return permutation;
+    }
+
+    // Returns the new id of an old vertex id.
+    int toNew(int oldId) const {
+        return newIds[oldId];
+    }
+
+    // Returns the old id of a new vertex id.
+    int toOld(int newId) const {
+        return oldIds[newId];
+    }
+
+    // Rewrites the vertices of a path found on the relabelled graph with their old ids.
+    template <typename WeightType>
+    void translate(GraphAlgorithm::SSSP::ShortestPath<WeightType>& path) const {
+        for (int& vertex : path.vertices) {
+            vertex = oldIds[vertex];
+        }
+    }
+
+    // Returns a shortest-path tree found on the relabelled graph indexed and linked by old ids.
+    template <typename WeightType>
+    GraphAlgorithm::SSSP::ShortestPathTree<WeightType> translate(const GraphAlgorithm::SSSP::ShortestPathTree<WeightType>& tree) const {
+        GraphAlgorithm::SSSP::ShortestPathTree<WeightType> result;
+        result.distances.resize(tree.distances.size());
+        result.previous.resize(tree.previous.size());
+        for (std::size_t v = 0; v < oldIds.size(); ++v) {
+            result.distances[oldIds[v]] = tree.distances[v];
+            result.previous[oldIds[v]] = tree.previous[v] == -1 ? -1 : oldIds[tree.previous[v]];
+        }
+        return result;
+    }
+};
+
+// Class computing locality-improving vertex orders and relabelling graphs with them.
+// Searches touch a vertex's neighbours and their distance and predecessor slots together; when related vertices get
+// nearby ids, those accesses fall in the same cache lines instead of missing on every relaxation. The graph-based
+// orders follow edges in both directions, so they suit forward and backward searches alike.
+template <typename VertexType, typename WeightType>
+class VertexReordering {
+public:
+    // Breadth-first order: each weakly connected component is numbered level by level from its lowest id.
+    template <typename GraphType>
+    static VertexPermutation bfs(const GraphType& graph) {
+        Adjacency adjacency = undirected(graph);
+        int numVertices = graph.vertexCount();
+        std::vector<int> order;
+        order.reserve(numVertices);
+        std::vector<char> visited(numVertices, 0);
+        for (int start = 0; start < numVertices; ++start) {
+            if (!visited[start]) {
+                visited[start] = 1;
+                order.push_back(start);
+                for (std::size_t head = order.size() - 1; head < order.size(); ++head) {
+                    int u = order[head];
+                    for (int i = adjacency.offsets[u]; i < adjacency.offsets[u + 1]; ++i) {
+                        int v = adjacency.neighbors[i];
+                        if (!visited[v]) {
+                            visited[v] = 1;
+                            order.push_back(v);
+                        }
+                    }
+                }
+            }
+        }
+        return VertexPermutation::fromOrder(std::move(order));
+    }
+
+    // Reverse Cuthill-McKee order: each weakly connected component is searched breadth-first from a pseudo-peripheral
+    // vertex, enqueuing the neighbours of every vertex by ascending degree, and the whole order is then reversed.
+    // This keeps every edge's endpoints close in the numbering, i.e. it minimizes the bandwidth of the adjacency matrix.
+    template <typename GraphType>
+    static VertexPermutation reverseCuthillMcKee(const GraphType& graph) {
+        Adjacency adjacency = undirected(graph);
+        int numVertices = graph.vertexCount();
+        // Components are started from their lowest-degree vertex, found by scanning the vertices by ascending degree.
+        std::vector<int> byDegree(numVertices);
+        std::iota(byDegree.begin(), byDegree.end(), 0);
+        std::stable_sort(byDegree.begin(), byDegree.end(), [&adjacency](int a, int b) { return adjacency.degree(a) < adjacency.degree(b); });
+
+        std::vector<int> order;
+        order.reserve(numVertices);
+        std::vector<char> visited(numVertices, 0);
+        std::vector<int> level(numVertices, -1); // Scratch for the pseudo-peripheral search.
+        std::vector<int> component;               // Scratch for the pseudo-peripheral search.
+        std::vector<int> children;
+        for (int start : byDegree) {
+            if (visited[start]) {
+                continue;
+            }
+            start = pseudoPeripheral(adjacency, start, level, component);
+            visited[start] = 1;
+            order.push_back(start);
+            for (std::size_t head = order.size() - 1; head < order.size(); ++head) {
+                int u = order[head];
+                children.clear();
+                for (int i = adjacency.offsets[u]; i < adjacency.offsets[u + 1]; ++i) {
+                    int v = adjacency.neighbors[i];
+                    if (!visited[v]) {
+                        visited[v] = 1;
+                        children.push_back(v);
+                    }
+                }
+                std::sort(children.begin(), children.end(), [&adjacency](int a, int b) {
+                    return adjacency.degree(a) != adjacency.degree(b) ? adjacency.degree(a) < adjacency.degree(b) : a < b;
+                });
+                order.insert(order.end(), children.begin(), children.end());
+            }
+        }
+        std::reverse(order.begin(), order.end());
+        return VertexPermutation::fromOrder(std::move(order));
+    }
+
+    // Hilbert curve order for vertices with planar coordinates: the bounding box is divided into a 2^16 by 2^16 grid
+    // and vertices are numbered along the curve through it, so vertices close in the plane get close ids.
+    // Ties keep the original id order.
+    static VertexPermutation hilbert(const std::vector<std::pair<double, double>>& coordinates) {
+        const int bits = 16;
+        const double cells = static_cast<double>((1 << bits) - 1);
+        int numVertices = static_cast<int>(coordinates.size());
+        double minX = 0, minY = 0, maxX = 0, maxY = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            if (v == 0 || coordinates[v].first < minX) minX = coordinates[v].first;
+            if (v == 0 || coordinates[v].first > maxX) maxX = coordinates[v].first;
+            if (v == 0 || coordinates[v].second < minY) minY = coordinates[v].second;
+            if (v == 0 || coordinates[v].second > maxY) maxY = coordinates[v].second;
+        }
+        double scaleX = maxX > minX ? cells / (maxX - minX) : 0;
+        double scaleY = maxY > minY ? cells / (maxY - minY) : 0;
+
+        std::vector<std::pair<std::uint64_t, int>> keys(numVertices);
+        for (int v = 0; v < numVertices; ++v) {
+            auto x = static_cast<std::uint32_t>((coordinates[v].first - minX) * scaleX);
+            auto y = static_cast<std::uint32_t>((coordinates[v].second - minY) * scaleY);
+            keys[v] = {hilbertIndex(x, y, bits), v};
+        }
+        std::sort(keys.begin(), keys.end());
+        std::vector<int> order(numVertices);
+        for (int i = 0; i < numVertices; ++i) {
+            order[i] = keys[i].second;
+        }
+        return VertexPermutation::fromOrder(std::move(order));
+    }
+
+    // Builds the relabelled graph in CSR form: new vertex i holds old vertex oldIds[i] and its edges with their targets
+    // renamed. Each vertex's edges are sorted by target, so a relaxation sweep reads its neighbours' state in order.
+    template <typename GraphType>
+    static GraphCSR<VertexType, WeightType> relabel(const GraphType& graph, const VertexPermutation& permutation) {
+        int numVertices = graph.vertexCount();
+        if (static_cast<int>(permutation.oldIds.size()) != numVertices) {
+            throw std::invalid_argument("Permutation does not match the graph");
+        }
+        std::vector<VertexType> vertices;
+        vertices.reserve(numVertices);
+        std::vector<int> offsets;
+        offsets.reserve(numVertices + 1);
+        offsets.push_back(0);
+        std::vector<int> targets;
+        std::vector<WeightType> weights;
+        std::vector<std::pair<int, WeightType>> edges;
+        for (int v = 0; v < numVertices; ++v) {
+            int old = permutation.oldIds[v];
+            vertices.push_back(graph.getVertex(old));
+            edges.clear();
+            for (const auto& edge : GraphAlgorithm::neighborsOf(graph, old)) {
+                edges.emplace_back(permutation.newIds[edge.first], edge.second);
+            }
+            std::stable_sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            for (const auto& edge : edges) {
+                targets.push_back(edge.first);
+                weights.push_back(edge.second);
+            }
+            offsets.push_back(static_cast<int>(targets.size()));
+        }
+        return GraphCSR<VertexType, WeightType>(std::move(vertices), std::move(offsets), std::move(targets), std::move(weights));
+    }
+
+private:
+    // Undirected view of a graph in CSR form: every edge appears at both endpoints, self-loops are dropped.
+    struct Adjacency {
+        std::vector<int> offsets;   // offsets[v] is the position of vertex v's first neighbour.
+        std::vector<int> neighbors; // Neighbours of every vertex, grouped by vertex.
+
+        // Returns the number of neighbours of a vertex.
+        int degree(int vertex) const {
+            return offsets[vertex + 1] - offsets[vertex];
+        }
+    };
+
+    // Builds the undirected view of a graph with a counting pass and a fill pass.
+    template <typename GraphType>
+    static Adjacency undirected(const GraphType& graph) {
+        int numVertices = graph.vertexCount();
+        Adjacency adjacency;
+        adjacency.offsets.assign(numVertices + 1, 0);
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : GraphAlgorithm::neighborsOf(graph, u)) {
+                if (edge.first != u) {
+                    ++adjacency.offsets[u + 1];
+                    ++adjacency.offsets[edge.first + 1];
+                }
+            }
+        }
+        for (int v = 0; v < numVertices; ++v) {
+            adjacency.offsets[v + 1] += adjacency.offsets[v];
+        }
+        adjacency.neighbors.resize(adjacency.offsets[numVertices]);
+        std::vector<int> next(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+        for (int u = 0; u < numVertices; ++u) {
+            for (const auto& edge : GraphAlgorithm::neighborsOf(graph, u)) {
+                if (edge.first != u) {
+                    adjacency.neighbors[next[u]++] = edge.first;
+                    adjacency.neighbors[next[edge.first]++] = u;
+                }
+            }
+        }
+        return adjacency;
+    }
+
+    // Finds a vertex of nearly maximal eccentricity in start's component (George and Liu): repeatedly search
+    // breadth-first and move to a lowest-degree vertex of the last level while that makes the search deeper.
+    // level and component are scratch buffers; level must hold -1 everywhere and is restored to that on return.
+    static int pseudoPeripheral(const Adjacency& adjacency, int start, std::vector<int>& level, std::vector<int>& component) {
+        int depth = -1;
+        for (int round = 0; round < 8; ++round) {
+            component.clear();
+            component.push_back(start);
+            level[start] = 0;
+            for (std::size_t head = 0; head < component.size(); ++head) {
+                int u = component[head];
+                for (int i = adjacency.offsets[u]; i < adjacency.offsets[u + 1]; ++i) {
+                    int v = adjacency.neighbors[i];
+                    if (level[v] == -1) {
+                        level[v] = level[u] + 1;
+                        component.push_back(v);
+                    }
+                }
+            }
+            int lastLevel = level[component.back()];
+            int candidate = component.back();
+            for (auto it = component.rbegin(); it != component.rend() && level[*it] == lastLevel; ++it) {
+                if (adjacency.degree(*it) < adjacency.degree(candidate)) {
+                    candidate = *it;
+                }
+            }
+            for (int v : component) {
+                level[v] = -1;
+            }
+            if (lastLevel <= depth) {
+                break;
+            }
+            depth = lastLevel;
+            start = candidate;
+        }
+        return start;
+    }
+
+    // Returns the position of cell (x, y) along the Hilbert curve through a 2^bits by 2^bits grid.
+    static std::uint64_t hilbertIndex(std::uint32_t x, std::uint32_t y, int bits) {
+        std::uint64_t index = 0;
+        for (std::uint32_t s = std::uint32_t(1) << (bits - 1); s > 0; s >>= 1) {
+            std::uint32_t rx = (x & s) > 0;
+            std::uint32_t ry = (y & s) > 0;
+            index += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+            // Rotate the quadrant so the curve's sub-curves connect.
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = s - 1 - x;
+                    y = s - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return index;
+    }
+};
+
+// A graph relabelled for locality, answering queries in the original ids.
+// Sources and destinations are translated to new ids on the way in and paths and trees back to old ids on the way out,
+// so callers never see the new numbering; graph() and permutation() expose it for other algorithms.
+template <typename VertexType, typename WeightType, typename QueueType = typename GraphAlgorithm::SSSP::DefaultQueue<WeightType>::type>
+class ReorderedGraph {
+public:
+    using Search = GraphAlgorithm::SSSP::Dijkstra<VertexType, WeightType, QueueType>;
+    using Workspace = typename Search::Workspace;
+
+    // Relabels a graph with the given permutation, typically one computed by VertexReordering.
+    template <typename GraphType>
+    ReorderedGraph(const GraphType& graph, VertexPermutation permutation)
+        : order(std::move(permutation)), relabelled(VertexReordering<VertexType, WeightType>::relabel(graph, order)) {}
+
+    // Returns the shortest path between two vertices given and returned in original ids.
+    GraphAlgorithm::SSSP::ShortestPath<WeightType> execute(int source, int destination, Workspace& workspace) const {
+        checkVertex(source);
+        checkVertex(destination);
+        GraphAlgorithm::SSSP::ShortestPath<WeightType> path = Search::execute(relabelled, order.toNew(source), order.toNew(destination), workspace);
+        order.translate(path);
+        return path;
+    }
+
+    // Returns the shortest path between two vertices given and returned in original ids.
+    GraphAlgorithm::SSSP::ShortestPath<WeightType> execute(int source, int destination) const {
+        Workspace workspace;
+        return execute(source, destination, workspace);
+    }
+
+    // Returns the shortest-path tree from a source, indexed and linked by original ids.
+    GraphAlgorithm::SSSP::ShortestPathTree<WeightType> shortestPathTree(int source) const {
+        checkVertex(source);
+        return order.translate(Search::shortestPathTree(relabelled, order.toNew(source)));
+    }
+
+    // Returns the relabelled graph.
+    const GraphCSR<VertexType, WeightType>& graph() const {
+        return relabelled;
+    }
+
+    // Returns the permutation between original and new ids.
+    const VertexPermutation& permutation() const {
+        return order;
+    }
+
+private:
+    VertexPermutation order;                      // Mapping between original and new ids.
+    GraphCSR<VertexType, WeightType> relabelled;  // Graph in new ids.
+
+    // Throws if an original vertex id is out of range.
+    void checkVertex(int vertex) const {
+        if (vertex < 0 || vertex >= static_cast<int>(order.newIds.size())) {
+            throw std::out_of_range("Vertex index out of range");
+        }
+    }
+};
+
+#endif // VERTEXREORDERING_H
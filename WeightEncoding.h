@@ -0,0 +1,108 @@
+// Author: Trevor Arcieri
+// Last Modified: 10/16/26
+
+#ifndef WEIGHTENCODING_H
+#define WEIGHTENCODING_H
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+
+// Weight encodings for the edge weights stored by GraphCSR. Every encoding provides:
+//   StorageType                  type of a stored weight
+//   encode(weights)              fit the encoding to a graph's weights and return them in stored form
+//   decode(stored)               turn a stored weight back into a WeightType
+// Smaller stored weights mean less memory traffic per relaxation and more of a large graph in cache. The lossy
+// encodings trade exactness for that: shortest paths are computed over the decoded weights.
+
+// Stores weights unchanged.
+template <typename WeightType>
+struct PlainWeights {
+    using StorageType = WeightType;
+
+    std::vector<StorageType> encode(std::vector<WeightType> weights) {
+        return weights;
+    }
+
+    StorageType decode(StorageType stored) const {
+        return stored;
+    }
+};
+
+// Stores weights as 32-bit floats, halving the storage of double weights at about 7 significant digits.
+template <typename WeightType>
+struct FloatWeights {
+    using StorageType = float;
+
+    std::vector<StorageType> encode(const std::vector<WeightType>& weights) {
+        return std::vector<StorageType>(weights.begin(), weights.end());
+    }
+
+    WeightType decode(StorageType stored) const {
+        return static_cast<WeightType>(stored);
+    }
+};
+
+// Stores non-negative weights as fixed-point integers, 16 bits by default: a weight w is stored as round(w / scale)
+// and read back as stored * scale. Unless a scale is given, encode() picks the smallest one that fits the largest
+// weight, so the error of each weight is at most scale / 2. Integral weights use an integral scale, which keeps
+// weights up to the storage type's maximum exact.
+template <typename WeightType, typename Storage = std::uint16_t>
+class FixedPointWeights {
+public:
+    using StorageType = Storage;
+
+    // Constructor chooses the scale; zero lets encode() fit it to the weights.
+    explicit FixedPointWeights(WeightType scale = 0) : scale(scale) {}
+
+    // Fits the scale if needed and returns the weights in fixed point.
+    // Throws std::invalid_argument on a negative weight and std::out_of_range if a weight exceeds the given scale's range.
+    std::vector<StorageType> encode(const std::vector<WeightType>& weights) {
+        WeightType largest = 0;
+        for (WeightType weight : weights) {
+            if (weight < 0) {
+                throw std::invalid_argument("Fixed-point weights must be non-negative");
+            }
+            largest = std::max(largest, weight);
+        }
+        const WeightType maxStored = static_cast<WeightType>(std::numeric_limits<StorageType>::max());
+        if (scale <= 0) {
+            if constexpr (std::is_integral<WeightType>::value) {
+                scale = std::max<WeightType>(1, largest / maxStored + (largest % maxStored != 0));
+            } else {
+                scale = largest > 0 ? largest / maxStored : 1;
+            }
+        } else if (largest / scale > maxStored) {
+            throw std::out_of_range("Weight exceeds the fixed-point range");
+        }
+
+        std::vector<StorageType> stored(weights.size());
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            if constexpr (std::is_integral<WeightType>::value) {
+                WeightType rounded = weights[i] / scale + (weights[i] % scale >= scale - scale / 2);
+                stored[i] = static_cast<StorageType>(std::min<WeightType>(rounded, maxStored));
+            } else {
+                stored[i] = static_cast<StorageType>(std::min<WeightType>(std::round(weights[i] / scale), maxStored));
+            }
+        }
+        return stored;
+    }
+
+    WeightType decode(StorageType stored) const {
+        return static_cast<WeightType>(stored) * scale;
+    }
+
+    // Returns the weight of one stored unit.
+    WeightType unit() const {
+        return scale;
+    }
+
+private:
+    WeightType scale; // Weight of one stored unit.
+};
+
+#endif // WEIGHTENCODING_H